@@ -0,0 +1,311 @@
+#include <Geometry/World.hxx>
+#include <Geometry/Snapshot.hxx>
+
+#include <iostream>
+#include <deque>
+#include <atomic>
+#include <cstdlib>
+
+namespace
+{
+	std::atomic <size_t> allocationsCount = 0;
+}
+
+void* operator new (size_t size)
+{
+	++allocationsCount;
+
+	if (auto ptr = std::malloc(size != 0 ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete (void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete (void* ptr, size_t) noexcept {
+	std::free(ptr);
+}
+
+namespace Coli
+{
+	namespace Bench
+	{
+		template <bool _Use2D, class _ScalarTy>
+		class Scenario final
+		{
+			using vector_type	 = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using rotator_type	 = Detail::rotator_t <_Use2D, _ScalarTy>;
+			using transform_type = Geometry::BasicTransform <_Use2D, _ScalarTy>;
+
+			/* the scenarios are described in double and converted to the measured precision */
+			using layout_type = glm::vec <_Use2D ? 2 : 3, double>;
+
+			template <class _ColliderTy>
+			void add (
+				vector_type const& position,
+				std::deque <_ColliderTy>& colliders,
+				_ColliderTy&& collider,
+				Geometry::BodyType type
+			) {
+				auto const key = myTransforms.size();
+
+				auto& transform = myTransforms.emplace_back(std::make_shared <transform_type>());
+				transform->position = position;
+
+				auto& placed = colliders.emplace_back(std::move(collider));
+				placed.bind_transform(transform);
+
+				myWorld.attach(key, placed);
+
+				if (type != Geometry::BodyType::static_body)
+				{
+					auto& body = myBodies.emplace_back();
+
+					body.bind_transform(transform);
+					body.set_type(type);
+
+					myWorld.attach(key, body);
+				}
+			}
+
+		public:
+			explicit Scenario (std::string_view name) :
+				myName (name)
+			{}
+
+			Scenario(Scenario&&)	  = delete;
+			Scenario(Scenario const&) = delete;
+
+			Scenario& operator=(Scenario&&)		 = delete;
+			Scenario& operator=(Scenario const&) = delete;
+
+			void add_sphere (layout_type const& position, double radius, Geometry::BodyType type = Geometry::BodyType::dynamic_body) {
+				add (vector_type{ position }, myRounds, Geometry::BasicRoundCollider<_Use2D, _ScalarTy>{ static_cast<_ScalarTy>(radius) }, type);
+			}
+
+			void add_box (layout_type const& position, layout_type const& size, Geometry::BodyType type = Geometry::BodyType::static_body)
+			{
+				Geometry::BasicBoxCollider<_Use2D, _ScalarTy> box { vector_type{ size }, Detail::default_rotator <rotator_type> };
+				box.enable_transform_rotation();
+
+				add (vector_type{ position }, myBoxes, std::move(box), type);
+			}
+
+			/* the kinematic bodies are moved by their transforms, the scenario shifts them before every step */
+			void add_moving_box (layout_type const& position, layout_type const& size, layout_type const& velocity)
+			{
+				add_box (position, size, Geometry::BodyType::kinematic_body);
+				myMovers.emplace_back(myTransforms.back(), vector_type{ velocity });
+			}
+
+			_NODISCARD nlohmann::json run (size_t steps, float time)
+			{
+				size_t pairs		= 0;
+				size_t contacts		= 0;
+				size_t allocations	= 0;
+
+				auto const start = std::chrono::steady_clock::now();
+
+				for (size_t i = 0; i < steps; ++i)
+				{
+					auto const allocationsBefore = allocationsCount.load();
+
+					for (auto const& [transform, velocity] : myMovers)
+						transform->position += velocity * static_cast<_ScalarTy>(time);
+
+					myWorld.step(time);
+
+					allocations += allocationsCount.load() - allocationsBefore;
+					pairs		+= myWorld.get_pairs_count();
+					contacts	+= myWorld.get_contacts_count();
+				}
+
+				std::chrono::duration <double> const elapsed = std::chrono::steady_clock::now() - start;
+				/* no steps leave the rates at zero instead of dividing by zero */
+				auto const count = static_cast<double>(std::max<size_t>(steps, 1));
+
+				nlohmann::json result;
+
+				result ["scenario"]			  = myName;
+				result ["dimensions"]		  = _Use2D ? 2 : 3;
+				result ["precision"]		  = std::same_as <_ScalarTy, float> ? "float" : "double";
+				result ["entries"]			  = myWorld.size();
+				result ["steps"]			  = steps;
+				result ["stepsPerSecond"]	  = steps != 0 ? count / elapsed.count() : 0.0;
+				result ["pairsPerStep"]		  = static_cast<double>(pairs) / count;
+				result ["contactsPerStep"]	  = static_cast<double>(contacts) / count;
+				result ["allocationsPerStep"] = static_cast<double>(allocations) / count;
+
+				return result;
+			}
+
+			/* the world is stepped between the rounds so every restore writes back the state it moved away from */
+			_NODISCARD nlohmann::json run_snapshots (size_t rounds, float time)
+			{
+				Geometry::BasicSnapshotRing <_Use2D, _ScalarTy> ring { 2 };
+				ring.reserve(myBodies.size());
+
+				size_t allocations = 0;
+
+				std::chrono::duration <double> captureTime { 0 };
+				std::chrono::duration <double> restoreTime { 0 };
+
+				for (size_t i = 0; i < rounds; ++i)
+				{
+					auto const allocationsBefore = allocationsCount.load();
+					auto const captureStart		 = std::chrono::steady_clock::now();
+
+					ring.capture(myWorld);
+
+					captureTime += std::chrono::steady_clock::now() - captureStart;
+					allocations += allocationsCount.load() - allocationsBefore;
+
+					myWorld.step(time);
+
+					auto const restoreStart = std::chrono::steady_clock::now();
+
+					ring.restore(myWorld);
+
+					restoreTime += std::chrono::steady_clock::now() - restoreStart;
+				}
+
+				auto const count = static_cast<double>(std::max<size_t>(rounds, 1));
+
+				nlohmann::json result;
+
+				result ["scenario"]				 = myName;
+				result ["dimensions"]			 = _Use2D ? 2 : 3;
+				result ["precision"]			 = std::same_as <_ScalarTy, float> ? "float" : "double";
+				result ["bodies"]				 = myBodies.size();
+				result ["rounds"]				 = rounds;
+				result ["captureMilliseconds"]	 = captureTime.count() * 1000.0 / count;
+				result ["restoreMilliseconds"]	 = restoreTime.count() * 1000.0 / count;
+				result ["allocationsPerCapture"] = static_cast<double>(allocations) / count;
+
+				return result;
+			}
+
+		private:
+			std::string myName;
+
+			std::vector <std::shared_ptr <transform_type>> myTransforms;
+			std::vector <std::pair <std::shared_ptr <transform_type>, vector_type>> myMovers;
+
+			std::deque <Geometry::BasicRoundCollider <_Use2D, _ScalarTy>> myRounds;
+			std::deque <Geometry::BasicBoxCollider <_Use2D, _ScalarTy>>   myBoxes;
+			std::deque <Geometry::BasicPhysicalBody <_Use2D, _ScalarTy>>  myBodies;
+
+			Geometry::BasicWorld <_Use2D, _ScalarTy> myWorld;
+		};
+
+		template <class _ScalarTy>
+		_NODISCARD nlohmann::json falling_spheres (size_t steps, float time)
+		{
+			Scenario <false, _ScalarTy> scenario { "falling_spheres" };
+			scenario.add_box ({ 0, -1, 0 }, { 100, 1, 100 });
+
+			for (int x = 0; x < 16; ++x)
+				for (int y = 0; y < 16; ++y)
+					for (int z = 0; z < 4; ++z)
+						scenario.add_sphere ({ x * 1.5 - 12, 2 + y * 1.5, z * 1.5 - 3 }, 0.5);
+
+			return scenario.run(steps, time);
+		}
+
+		template <class _ScalarTy>
+		_NODISCARD nlohmann::json box_pyramid (size_t steps, float time)
+		{
+			Scenario <false, _ScalarTy> scenario { "box_pyramid" };
+			scenario.add_box ({ 0, -1, 0 }, { 100, 1, 100 });
+
+			constexpr int base = 20;
+
+			for (int row = 0; row < base; ++row)
+				for (int column = 0; column < base - row; ++column)
+					scenario.add_box (
+						{ column * 1.0 + row * 0.5 - base / 2.0, 0.5 + row * 1.0, 0 },
+						{ 1, 1, 1 },
+						Geometry::BodyType::dynamic_body
+					);
+
+			return scenario.run(steps, time);
+		}
+
+		template <class _ScalarTy>
+		_NODISCARD nlohmann::json circle_pile (size_t steps, float time)
+		{
+			Scenario <true, _ScalarTy> scenario { "circle_pile" };
+
+			scenario.add_box ({   0, -1 }, { 62,  2 });
+			scenario.add_box ({ -30, 40 }, {  2, 80 });
+			scenario.add_box ({  30, 40 }, {  2, 80 });
+
+			for (int x = 0; x < 50; ++x)
+				for (int y = 0; y < 40; ++y)
+					scenario.add_sphere ({ x * 1.1 - 27, 1 + y * 1.1 }, 0.5);
+
+			return scenario.run(steps, time);
+		}
+
+		template <class _ScalarTy>
+		_NODISCARD nlohmann::json mixed_level (size_t steps, float time)
+		{
+			Scenario <true, _ScalarTy> scenario { "mixed_level" };
+
+			for (int x = 0; x < 40; ++x)
+				for (int y = 0; y < 25; ++y)
+					scenario.add_box ({ x * 4.0, y * 4.0 }, { 2, 0.5 });
+
+			/* the platforms sweep through the level in both directions */
+			for (int i = 0; i < 20; ++i)
+				scenario.add_moving_box ({ i * 8.0, 50 }, { 1, 1 }, { i % 2 == 0 ? 3.0 : -3.0, -2.0 });
+
+			for (int x = 0; x < 40; ++x)
+				for (int y = 0; y < 25; ++y)
+					scenario.add_sphere ({ x * 4.0 + 1, y * 4.0 + 2 }, 0.4);
+
+			return scenario.run(steps, time);
+		}
+
+		template <class _ScalarTy>
+		_NODISCARD nlohmann::json snapshot_spheres (size_t rounds, float time)
+		{
+			Scenario <false, _ScalarTy> scenario { "snapshot_spheres" };
+
+			/* ten thousand spheres spaced apart, the cost of a snapshot only depends on the bodies count */
+			for (int x = 0; x < 25; ++x)
+				for (int y = 0; y < 16; ++y)
+					for (int z = 0; z < 25; ++z)
+						scenario.add_sphere ({ x * 2.0, y * 2.0, z * 2.0 }, 0.5);
+
+			return scenario.run_snapshots(rounds, time);
+		}
+	}
+}
+
+int main (int argc, char** argv)
+{
+	using namespace Coli::Bench;
+
+	size_t const steps = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 600;
+	float  const time  = 1.f / 60.f;
+
+	nlohmann::json report = nlohmann::json::array();
+
+	report.push_back(falling_spheres <double> (steps, time));
+	report.push_back(box_pyramid	 <double> (steps, time));
+	report.push_back(circle_pile	 <double> (steps, time));
+	report.push_back(mixed_level	 <double> (steps, time));
+	report.push_back(snapshot_spheres<double> (steps, time));
+
+	report.push_back(falling_spheres <float> (steps, time));
+	report.push_back(box_pyramid	 <float> (steps, time));
+	report.push_back(circle_pile	 <float> (steps, time));
+	report.push_back(mixed_level	 <float> (steps, time));
+	report.push_back(snapshot_spheres<float> (steps, time));
+
+	std::cout << report.dump(4) << std::endl;
+}
\ No newline at end of file
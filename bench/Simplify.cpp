@@ -0,0 +1,85 @@
+#include <Geometry/Simplifier.hxx>
+
+#include <iostream>
+#include <cstdlib>
+
+namespace Coli
+{
+	namespace Bench
+	{
+		using vertex_type = Geometry::Vertex;
+		using mesh_type	  = Geometry::Mesh <vertex_type>;
+
+		using simplifier_type = Geometry::MeshSimplifier <vertex_type>;
+
+		/* the sphere of a thousand meridians and five hundred parallels has a million triangles */
+		_NODISCARD mesh_type make_input (unsigned meridians)
+		{
+			return Geometry::SphereMeshGenerator <vertex_type>{}(1.0, meridians, meridians / 2);
+		}
+
+		_NODISCARD nlohmann::json run (std::string_view name, mesh_type const& mesh, simplifier_type::Configuration const& config)
+		{
+			auto const start  = std::chrono::steady_clock::now();
+			auto const result = simplifier_type{ config }(mesh);
+
+			std::chrono::duration <double> const elapsed = std::chrono::steady_clock::now() - start;
+			auto const inputTriangles = mesh.size() / 3;
+
+			nlohmann::json report;
+
+			report ["scenario"]			  = name;
+			report ["chunks"]			  = config.chunks;
+			report ["inputTriangles"]	  = inputTriangles;
+			report ["outputTriangles"]	  = result.size() / 3;
+			report ["outputVertices"]	  = result.get_vertices().size();
+			report ["seconds"]			  = elapsed.count();
+			report ["trianglesPerSecond"] = static_cast<double>(inputTriangles) / elapsed.count();
+
+			return report;
+		}
+
+		_NODISCARD nlohmann::json to_ratio (mesh_type const& mesh, double ratio, size_t chunks)
+		{
+			simplifier_type::Configuration config;
+
+			config.targetTriangles = static_cast<size_t>(static_cast<double>(mesh.size() / 3) * ratio);
+			config.maxError		   = std::numeric_limits <double>::infinity();
+			config.chunks		   = chunks;
+
+			return run("to_ratio_" + std::to_string(ratio), mesh, config);
+		}
+
+		_NODISCARD nlohmann::json to_error (mesh_type const& mesh, double error, size_t chunks)
+		{
+			simplifier_type::Configuration config;
+
+			config.maxError = error;
+			config.chunks	= chunks;
+
+			return run("to_error_" + std::to_string(error), mesh, config);
+		}
+	}
+}
+
+int main (int argc, char** argv)
+{
+	using namespace Coli::Bench;
+
+	unsigned const meridians = argc > 1 ? static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10)) : 1000;
+
+	auto const mesh = make_input(meridians);
+
+	nlohmann::json report = nlohmann::json::array();
+
+	/* one chunk is the serial baseline, zero takes one chunk per hardware thread */
+	for (size_t const chunks : { 1, 0 })
+	{
+		report.push_back(to_ratio (mesh, 0.5,  chunks));
+		report.push_back(to_ratio (mesh, 0.1,  chunks));
+		report.push_back(to_ratio (mesh, 0.01, chunks));
+		report.push_back(to_error (mesh, 0.001, chunks));
+	}
+
+	std::cout << report.dump(4) << std::endl;
+}
\ No newline at end of file
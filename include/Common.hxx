@@ -4,6 +4,7 @@
 #include <span>
 #include <memory>
 #include <future>
+#include <thread>
 #include <string_view>
 #include <string>
 #include <chrono>
@@ -14,6 +15,7 @@
 #include <optional>
 #include <iterator>
 #include <algorithm>
+#include <numeric>
 #include <stdexcept>
 #include <execution>
 #include <syncstream>
@@ -28,6 +30,7 @@
 #include <cuchar>
 
 #include <set>
+#include <map>
 #include <array>
 #include <vector>
 #include <forward_list>
@@ -38,6 +41,7 @@
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/gtx/compatibility.hpp>
 
 #include <glad/glad.h>
@@ -46,6 +50,11 @@
 #include <nlohmann/json.hpp>
 #include <tiny_obj_loader.h>
 
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#	include <xmmintrin.h>
+#	define COLI_SSE
+#endif
+
 #include "Common/Identifiable.hxx"
 #include "Common/KeepsChange.hxx"
 #include "Common/Singleton.hxx"
@@ -57,6 +57,18 @@ namespace Coli
 				isVisible = false;
 			}
 
+			/* packs the flags into a single byte for the binary snapshots */
+			_NODISCARD uint8_t get_state_flags() const noexcept {
+				return static_cast<uint8_t>(isStarted | isVisible << 1 | isActive << 2);
+			}
+
+			void set_state_flags (uint8_t flags) noexcept 
+			{
+				isStarted = (flags & 1) != 0;
+				isVisible = (flags & 2) != 0;
+				isActive  = (flags & 4) != 0;
+			}
+
 		protected:
 			void mark_started() noexcept {
 				isStarted = true;
@@ -6,6 +6,8 @@
 #include "Loader.hxx"
 
 #include "../Geometry/Mesh.hxx"
+#include "../Geometry/Simplifier.hxx"
+#include "../Geometry/IndexOptimizer.hxx"
 
 namespace Coli
 {
@@ -32,6 +34,20 @@ namespace Coli
 			MeshLoader& operator=(MeshLoader&&)      = delete;
 			MeshLoader& operator=(MeshLoader const&) = delete;
 
+			/* the loaded meshes are reordered for the vertex cache, the input order of the large files rarely fits it */
+			void set_optimization (bool enabled) noexcept {
+				myOptimization = enabled;
+			}
+
+			_NODISCARD bool has_optimization() const noexcept {
+				return myOptimization;
+			}
+
+			/* the miss ratios of the last optimized mesh or of the first level of a chain, nothing before the first one */
+			_NODISCARD std::optional <Geometry::IndexStatistics> const& get_statistics() const noexcept {
+				return myStatistics;
+			}
+
 			template <Detail::Vertex _VertexTy>
 			_NODISCARD Geometry::Mesh <_VertexTy> load (std::string_view assetName)
 			{
@@ -70,8 +86,40 @@ namespace Coli
 						vertex.texcoord.x = vertex.texcoord.y = 0;
 				}
 
-				return Geometry::Mesh<_VertexTy>{ vertices };
+				Geometry::Mesh<_VertexTy> mesh { vertices };
+
+				if (!myOptimization)
+					return mesh;
+
+				return Geometry::IndexOptimizer<_VertexTy>{}(mesh, myStatistics.emplace());
 			}
+
+			/* the levels of detail from the loaded mesh, every next level keeps the ratio of the triangles of the previous one */
+			template <Detail::Vertex _VertexTy>
+			_NODISCARD std::vector <Geometry::Mesh <_VertexTy>> load (
+				std::string_view assetName,
+				size_t levels,
+				double ratio = 0.5,
+				typename Geometry::MeshSimplifier<_VertexTy>::Configuration const& config = {}
+			) {
+				auto chain = Geometry::MeshSimplifier<_VertexTy>{ config }(load<_VertexTy>(assetName), levels, ratio);
+
+				/* the first level is optimized by its load already, the statistics stay the ones of that full level */
+				if (myOptimization)
+				{
+					Geometry::IndexStatistics statistics;
+
+					for (size_t i = 1; i < chain.size(); ++i)
+						chain[i] = Geometry::IndexOptimizer<_VertexTy>{}(chain[i], statistics);
+				}
+
+				return chain;
+			}
+
+		private:
+			std::optional <Geometry::IndexStatistics> myStatistics;
+
+			bool myOptimization = false;
 		};
 	}
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "Asset.hxx"
 #include "Entity.hxx"
 
+#include "../Geometry/Contact.hxx"
+
 namespace Coli
 {
 	namespace Detail
@@ -16,6 +18,7 @@ namespace Coli
 	namespace Game
 	{
 		class Object;
+		class Scene;
 
 		class ComponentBase :
 			public Detail::EntityBase
@@ -83,6 +86,38 @@ namespace Coli
 			_NODISCARD static constexpr Category get_category() noexcept {
 				return Category::script;
 			}
+
+			virtual void on_collision_enter (Object& other) {}
+			virtual void on_collision_stay	(Object& other) {}
+			virtual void on_collision_exit	(Object& other) {}
+
+			virtual void on_trigger_enter (Object& other) {}
+			virtual void on_trigger_stay  (Object& other) {}
+			virtual void on_trigger_exit  (Object& other) {}
+
+		private:
+			void report_contact (Geometry::ContactPhase phase, bool trigger, Object& other)
+			{
+				if (!this->is_active())
+					return;
+
+				switch (phase)
+				{
+				case Geometry::ContactPhase::enter:
+					trigger ? on_trigger_enter(other) : on_collision_enter(other);
+					break;
+
+				case Geometry::ContactPhase::stay:
+					trigger ? on_trigger_stay(other) : on_collision_stay(other);
+					break;
+
+				case Geometry::ContactPhase::exit:
+					trigger ? on_trigger_exit(other) : on_collision_exit(other);
+					break;
+				}
+			}
+
+			friend class Scene;
 		};
 	}
 
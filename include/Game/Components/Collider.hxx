@@ -4,8 +4,10 @@
 #include "../../Utility.hxx"
 
 #include "Transform.hxx"
+#include "WorldAttachment.hxx"
 #include "../Component.hxx"
 #include "../../Geometry/Collider.hxx"
+#include "../../Geometry/HullCollider.hxx"
 
 namespace Coli
 {
@@ -21,7 +23,6 @@ namespace Coli
 				ColliderBase() noexcept = default;
 
 			public:
-				void start()  noexcept final {}
 				void render() noexcept final {}
 
 				void update (float)		 noexcept final {}
@@ -32,20 +33,21 @@ namespace Coli
 				}
 			};
 
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicBoxCollider final :
-				public ColliderBase,
-				public Geometry::BasicBoxCollider <_Use2D>
+				public  ColliderBase,
+				public  Geometry::BasicBoxCollider <_Use2D, _ScalarTy>,
+				private Detail::WorldAttachment <_Use2D, _ScalarTy, Detail::SAT::ColliderBase <_Use2D, _ScalarTy>>
 			{
-				using vector_type  = glm::vec <_Use2D ? 2 : 3, double>;
-				using rotator_type = std::conditional_t <_Use2D, double, glm::dquat>;
+				using vector_type  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+				using rotator_type = Detail::rotator_t <_Use2D, _ScalarTy>;
 
 			public:
 				BasicBoxCollider (
 					vector_type const& size,
 					rotator_type const& rotator = Detail::default_rotator <rotator_type>
 				) noexcept :
-					Geometry::BasicBoxCollider<_Use2D>(size, rotator)
+					Geometry::BasicBoxCollider<_Use2D, _ScalarTy>(size, rotator)
 				{}
 
 				BasicBoxCollider(BasicBoxCollider&&)	  = delete;
@@ -54,17 +56,27 @@ namespace Coli
 				BasicBoxCollider& operator=(BasicBoxCollider&&)		 = delete;
 				BasicBoxCollider& operator=(BasicBoxCollider const&) = delete;
 
+				void on_start() final
+				{
+					auto& owner = this->get_owner();
+
+					if (owner.template has_component <Components::BasicTransform <_Use2D, _ScalarTy>>())
+						this->bind_transform(owner.template get_component <Components::BasicTransform <_Use2D, _ScalarTy>>());
+
+					this->attach_to_world(*this, *this);
+				}
+
 				void on_restore (nlohmann::json const& obj) final 
 				{
-					auto& base     = static_cast <Geometry::BasicBoxCollider <_Use2D>&>(*this);
-					auto  restored = static_cast <Geometry::BasicBoxCollider <_Use2D>>(obj);
+					auto& base     = static_cast <Geometry::BasicBoxCollider <_Use2D, _ScalarTy>&>(*this);
+					auto  restored = static_cast <Geometry::BasicBoxCollider <_Use2D, _ScalarTy>>(obj);
 					
 					base = restored;
 				}
 			
 				_NODISCARD nlohmann::json on_save() const final
 				{
-					auto const&    base = static_cast <Geometry::BasicBoxCollider <_Use2D> const&>(*this);
+					auto const&    base = static_cast <Geometry::BasicBoxCollider <_Use2D, _ScalarTy> const&>(*this);
 					nlohmann::json object;
 
 					object = base;
@@ -72,14 +84,15 @@ namespace Coli
 				}
 			};
 
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicRoundCollider final :
-				public ColliderBase,
-				public Geometry::BasicRoundCollider <_Use2D>
+				public  ColliderBase,
+				public  Geometry::BasicRoundCollider <_Use2D, _ScalarTy>,
+				private Detail::WorldAttachment <_Use2D, _ScalarTy, Detail::SAT::ColliderBase <_Use2D, _ScalarTy>>
 			{
 			public:
-				BasicRoundCollider (double radius) noexcept :
-					Geometry::BasicRoundCollider<_Use2D>(radius)
+				BasicRoundCollider (_ScalarTy radius) noexcept :
+					Geometry::BasicRoundCollider<_Use2D, _ScalarTy>(radius)
 				{}
 					
 				BasicRoundCollider(BasicRoundCollider&&)	  = delete;
@@ -88,17 +101,76 @@ namespace Coli
 				BasicRoundCollider& operator=(BasicRoundCollider&&)		 = delete;
 				BasicRoundCollider& operator=(BasicRoundCollider const&) = delete;
 
+				void on_start() final
+				{
+					auto& owner = this->get_owner();
+
+					if (owner.template has_component <Components::BasicTransform <_Use2D, _ScalarTy>>())
+						this->bind_transform(owner.template get_component <Components::BasicTransform <_Use2D, _ScalarTy>>());
+
+					this->attach_to_world(*this, *this);
+				}
+
+				void on_restore (nlohmann::json const& obj) final 
+				{
+					auto& base     = static_cast <Geometry::BasicRoundCollider <_Use2D, _ScalarTy>&>(*this);
+					auto  restored = static_cast <Geometry::BasicRoundCollider <_Use2D, _ScalarTy>>(obj);
+					
+					base = restored;
+				}
+			
+				_NODISCARD nlohmann::json on_save() const final
+				{
+					auto const&    base = static_cast <Geometry::BasicRoundCollider <_Use2D, _ScalarTy> const&>(*this);
+					nlohmann::json object;
+
+					object = base;
+					return object;
+				}
+			};
+
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
+			class BasicHullCollider final :
+				public  ColliderBase,
+				public  Geometry::BasicHullCollider <_Use2D, _ScalarTy>,
+				private Detail::WorldAttachment <_Use2D, _ScalarTy, Detail::SAT::ColliderBase <_Use2D, _ScalarTy>>
+			{
+			public:
+				template <Detail::Vertex _VertexTy>
+				BasicHullCollider (
+					Geometry::Mesh <_VertexTy> const& mesh,
+					size_t maxVertices = Geometry::BasicConvexHull <_Use2D, _ScalarTy>::default_max_vertices
+				) :
+					Geometry::BasicHullCollider<_Use2D, _ScalarTy>(mesh, maxVertices)
+				{}
+
+				BasicHullCollider(BasicHullCollider&&)	    = delete;
+				BasicHullCollider(BasicHullCollider const&) = delete;
+
+				BasicHullCollider& operator=(BasicHullCollider&&)	   = delete;
+				BasicHullCollider& operator=(BasicHullCollider const&) = delete;
+
+				void on_start() final
+				{
+					auto& owner = this->get_owner();
+
+					if (owner.template has_component <Components::BasicTransform <_Use2D, _ScalarTy>>())
+						this->bind_transform(owner.template get_component <Components::BasicTransform <_Use2D, _ScalarTy>>());
+
+					this->attach_to_world(*this, *this);
+				}
+
 				void on_restore (nlohmann::json const& obj) final 
 				{
-					auto& base     = static_cast <Geometry::BasicRoundCollider <_Use2D>&>(*this);
-					auto  restored = static_cast <Geometry::BasicRoundCollider <_Use2D>>(obj);
+					auto& base     = static_cast <Geometry::BasicHullCollider <_Use2D, _ScalarTy>&>(*this);
+					auto  restored = static_cast <Geometry::BasicHullCollider <_Use2D, _ScalarTy>>(obj);
 					
 					base = restored;
 				}
 			
 				_NODISCARD nlohmann::json on_save() const final
 				{
-					auto const&    base = static_cast <Geometry::BasicRoundCollider <_Use2D> const&>(*this);
+					auto const&    base = static_cast <Geometry::BasicHullCollider <_Use2D, _ScalarTy> const&>(*this);
 					nlohmann::json object;
 
 					object = base;
@@ -111,6 +183,18 @@ namespace Coli
 
 			using SphereCollider   = BasicRoundCollider <false>;
 			using CircleCollider2D = BasicRoundCollider <true>;
+
+			using HullCollider   = BasicHullCollider <false>;
+			using HullCollider2D = BasicHullCollider <true>;
+
+			using BoxColliderF   = BasicBoxCollider <false, float>;
+			using BoxCollider2DF = BasicBoxCollider <true,  float>;
+
+			using SphereColliderF   = BasicRoundCollider <false, float>;
+			using CircleCollider2DF = BasicRoundCollider <true,  float>;
+
+			using HullColliderF   = BasicHullCollider <false, float>;
+			using HullCollider2DF = BasicHullCollider <true,  float>;
 		}
 	}
 }
\ No newline at end of file
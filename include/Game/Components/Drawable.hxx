@@ -4,6 +4,7 @@
 #include "../../Utility.hxx"
 
 #include "Transform.hxx"
+#include "../Scene.hxx"
 #include "../../Graphics/Drawable.hxx"
 #include "../../Graphics/Renderer.hxx"
 
@@ -13,7 +14,8 @@ namespace Coli
 	{
 		namespace Components
 		{
-			template <bool _Use2D>
+			/* the scalar is the one of the transform the model is read from */
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicDrawable :
 				public  Game::ComponentBase,
 				private Graphics::Drawable <Geometry::BasicVertex<_Use2D>>
@@ -22,28 +24,79 @@ namespace Coli
 
 			public:
 				using base::set_material;
+				using base::set_thresholds;
+				using base::get_levels_count;
+				using base::get_level;
 
 				BasicDrawable(Geometry::Mesh <Geometry::BasicVertex <_Use2D>> const& mesh) :
 					base (mesh)
 				{}
 
-				void start		 ()	     noexcept final {}
-				void late_update (float) noexcept final {}
+				/* the levels of detail from the finest to the coarsest */
+				BasicDrawable(std::span <Geometry::Mesh <Geometry::BasicVertex <_Use2D>> const> levels) :
+					base (levels)
+				{}
+
+				BasicDrawable(std::shared_ptr <Detail::MeshContext <Geometry::BasicVertex <_Use2D>>> mesh) :
+					base (std::move(mesh))
+				{}
 
-				void on_update (float) final 
+				~BasicDrawable() noexcept {
+					set_static(false);
+				}
+
+				/* the static drawables never move, the renderer culls them by its hierarchy instead of one by one */
+				void set_static (bool isStatic) noexcept
 				{
-					if (auto transform = myTransform.lock())
-						base::update(*transform);
+					myStaticFlag = isStatic;
+
+					if (!isStatic && myStaticHandle != Graphics::Renderer::null_static)
+					{
+						if (auto renderer = this->get_renderer())
+							renderer->release_static(myStaticHandle);
 
-					else {
-						auto& owner = get_owner();
-						myTransform = owner.get_component <Game::Components::BasicTransform <_Use2D>>();
-					}						
+						myStaticHandle = Graphics::Renderer::null_static;
+					}
 				}
 
-				void on_render() final {
-					if (auto renderer = this->get_renderer())
-						renderer->draw(*this);
+				_NODISCARD bool is_static() const noexcept {
+					return myStaticFlag;
+				}
+
+				/* the occluder hides the other drawables when the renderer has the occlusion pass enabled */
+				void set_occluder (std::shared_ptr <Geometry::Occluder const> occluder) noexcept {
+					myOccluder = std::move(occluder);
+				}
+
+				void start () noexcept final {}
+
+				/* the model is written after the physics steps of the frame so it can be blended between them */
+				void on_late_update (float) final 
+				{
+					auto& owner = get_owner();
+
+					/* the transform found is written at once, the first frame must not draw the identity model */
+					if (myTransform.expired())
+						myTransform = owner.get_component <Game::Components::BasicTransform <_Use2D, _ScalarTy>>();
+
+					if (auto transform = myTransform.lock())
+						base::update(*transform, owner.get_scene().get_step_alpha());
+				}
+
+				void on_render() final 
+				{
+					auto renderer = this->get_renderer();
+
+					if (!renderer)
+						return;
+
+					if (myOccluder)
+						renderer->submit_occluder(*myOccluder, *this);
+
+					if (myStaticFlag)
+						myStaticHandle = renderer->submit_static(*this, myStaticHandle, get_owner().get_layer());
+					else
+						renderer->submit(*this, get_owner().get_layer());
 				}
 
 				_NODISCARD static constexpr ComponentBase::Category get_category() noexcept {
@@ -51,11 +104,19 @@ namespace Coli
 				}
 
 			private:
-				std::weak_ptr <Geometry::BasicTransform <_Use2D> const> myTransform;
+				std::weak_ptr <Geometry::BasicTransform <_Use2D, _ScalarTy> const> myTransform;
+
+				std::shared_ptr <Geometry::Occluder const> myOccluder;
+
+				size_t myStaticHandle = Graphics::Renderer::null_static;
+				bool   myStaticFlag	  = false;
 			};
 
 			using Drawable   = BasicDrawable <false>;
 			using Drawable2D = BasicDrawable <true>;
+
+			using DrawableF   = BasicDrawable <false, float>;
+			using Drawable2DF = BasicDrawable <true,  float>;
 		}
 	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../../Utility.hxx"
 
 #include "Transform.hxx"
+#include "WorldAttachment.hxx"
 #include "../Component.hxx"
 
 #include "../../Geometry/Collider.hxx"
@@ -23,7 +24,6 @@ namespace Coli
 				PhysicalBodyBase() noexcept = default;
 
 			public:
-				void start()  noexcept final {}
 				void render() noexcept final {}
 				void on_update (float) noexcept final {}
 
@@ -32,28 +32,34 @@ namespace Coli
 				}
 			};
 
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicPhysicalBody final :
-				public PhysicalBodyBase,
-				public Geometry::BasicPhysicalBody <_Use2D>
+				public  PhysicalBodyBase,
+				public  Geometry::BasicPhysicalBody <_Use2D, _ScalarTy>,
+				private Detail::WorldAttachment <_Use2D, _ScalarTy, Geometry::BasicPhysicalBody <_Use2D, _ScalarTy>>
 			{
 			public:
-				void on_late_update (float time) noexcept final {
-					this->apply_forces   (time);
-					this->apply_velocity (time);
+				void on_start() final
+				{
+					auto& owner = this->get_owner();
+
+					if (owner.template has_component <Components::BasicTransform <_Use2D, _ScalarTy>>())
+						this->bind_transform(owner.template get_component <Components::BasicTransform <_Use2D, _ScalarTy>>());
+
+					this->attach_to_world(*this, *this, &owner);
 				}
 
 				void on_restore(nlohmann::json const& obj) final
 				{
-					auto& base     = static_cast <Geometry::BasicPhysicalBody <_Use2D>&>(*this);
-					auto  restored = static_cast <Geometry::BasicPhysicalBody <_Use2D>>(obj);
+					auto& base     = static_cast <Geometry::BasicPhysicalBody <_Use2D, _ScalarTy>&>(*this);
+					auto  restored = static_cast <Geometry::BasicPhysicalBody <_Use2D, _ScalarTy>>(obj);
 
 					base = restored;
 				}
 
 				_NODISCARD nlohmann::json on_save() const final
 				{
-					auto const& base = static_cast <Geometry::BasicPhysicalBody <_Use2D> const&>(*this);
+					auto const& base = static_cast <Geometry::BasicPhysicalBody <_Use2D, _ScalarTy> const&>(*this);
 					nlohmann::json object;
 
 					object = base;
@@ -63,6 +69,9 @@ namespace Coli
 
 			using PhysicalBody   = BasicPhysicalBody <false>;
 			using PhysicalBody2D = BasicPhysicalBody <true>;
+
+			using PhysicalBodyF   = BasicPhysicalBody <false, float>;
+			using PhysicalBody2DF = BasicPhysicalBody <true,  float>;
 		}
 	}
 }
\ No newline at end of file
@@ -12,11 +12,11 @@ namespace Coli
 	{
 		namespace Components
 		{
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicTransform final :
 				public Detail::AssetBase,
 				public ComponentBase,
-				public Geometry::BasicTransform <_Use2D>
+				public Geometry::BasicTransform <_Use2D, _ScalarTy>
 			{
 			public:
 				void start ()  noexcept final {}
@@ -29,15 +29,15 @@ namespace Coli
 				
 				void on_restore(nlohmann::json const& obj) final
 				{
-					auto& base     = static_cast <Geometry::BasicTransform <_Use2D>&>(*this);
-					auto  restored = static_cast <Geometry::BasicTransform <_Use2D>>(obj);
+					auto& base     = static_cast <Geometry::BasicTransform <_Use2D, _ScalarTy>&>(*this);
+					auto  restored = static_cast <Geometry::BasicTransform <_Use2D, _ScalarTy>>(obj);
 
 					base = restored;
 				}
 
 				_NODISCARD nlohmann::json on_save() const final
 				{
-					auto const& base = static_cast <Geometry::BasicTransform <_Use2D> const&>(*this);
+					auto const& base = static_cast <Geometry::BasicTransform <_Use2D, _ScalarTy> const&>(*this);
 					nlohmann::json object;
 
 					object = base;
@@ -51,6 +51,9 @@ namespace Coli
 
 			using Transform   = BasicTransform <false>;
 			using Transform2D = BasicTransform <true>;
+
+			using TransformF   = BasicTransform <false, float>;
+			using Transform2DF = BasicTransform <true,  float>;
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "../../Common.hxx"
+#include "../../Utility.hxx"
+
+#include "Transform.hxx"
+#include "../Component.hxx"
+
+#include "../../Geometry/World.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		template <bool _Use2D, class _ScalarTy, class _GeometryTy>
+		class WorldAttachment
+		{
+		protected:
+			WorldAttachment() noexcept = default;
+
+			~WorldAttachment() noexcept {
+				if (auto world = myWorld.lock())
+					world->detach(myKey, *myGeometry);
+			}
+
+			/* the component is taken generically since the scene is incomplete at this point */
+			void attach_to_world (auto& component, _GeometryTy& geometry, auto&&... args)
+			{
+				auto& owner = component.get_owner();
+				auto  world = owner.get_scene().template get_world<_Use2D, _ScalarTy>().lock();
+
+				if (!world)
+					return;
+
+				myKey	   = owner.get_id();
+				myGeometry = &geometry;
+				myWorld	   = world;
+
+				world->attach(myKey, geometry, args...);
+			}
+
+		public:
+			WorldAttachment(WorldAttachment&&)		= delete;
+			WorldAttachment(WorldAttachment const&) = delete;
+
+			WorldAttachment& operator=(WorldAttachment&&)	   = delete;
+			WorldAttachment& operator=(WorldAttachment const&) = delete;
+
+		private:
+			std::weak_ptr <Geometry::BasicWorld <_Use2D, _ScalarTy>> myWorld;
+
+			_GeometryTy* myGeometry = nullptr;
+			size_t		 myKey		= 0;
+		};
+	}
+}
\ No newline at end of file
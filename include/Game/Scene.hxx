@@ -6,6 +6,7 @@
 #include "Object.hxx"
 
 #include "../Visual/Camera.hxx"
+#include "../Geometry/World.hxx"
 
 #include "Components/PhysicalBody.hxx"
 #include "Components/Collider.hxx"
@@ -41,13 +42,22 @@ namespace Coli
 
 				ptr -> set_scene(me);
 				myObjects.emplace(ptr);
+				myObjectsByID.insert_or_assign(ptr->get_id(), ptr.get());
 
 				return ptr;
 			}
 
 			template <GameObject _Ty>
-			void remove_object(std::shared_ptr<_Ty> const& ptr) noexcept {
-				myObjects.erase(ptr);
+			void remove_object(std::shared_ptr<_Ty> const& ptr) noexcept 
+			{
+				if (myObjects.erase(ptr) != 0)
+					myObjectsByID.erase(ptr->get_id());
+			}
+
+			_NODISCARD Game::Object* find_object (size_t id) const noexcept
+			{
+				auto iter = myObjectsByID.find(id);
+				return iter != myObjectsByID.end() ? iter->second : nullptr;
 			}
 
 		private:
@@ -115,6 +125,8 @@ namespace Coli
 
 			std::multiset <std::shared_ptr <Game::Object>, comparator_type> myObjects;
 			std::vector   <std::shared_ptr <Game::Object>> myChangedObjects;
+
+			std::unordered_map <size_t, Game::Object*> myObjectsByID;
 		};
 	}
 
@@ -122,12 +134,42 @@ namespace Coli
 	{
 		class Scene final :
 			public Detail::EntityBase,
-			public Detail::ObjectsContainerBase
+			public Detail::ObjectsContainerBase,
+			private Geometry::ContactListener
 		{
+			void report_contact (Geometry::ContactPhase phase, bool trigger, Object& object, Object& other)
+			{
+				if (!object.has_component <ScriptBase>())
+					return;
+
+				if (auto script = object.get_component <ScriptBase>().lock())
+					script->report_contact(phase, trigger, other);
+			}
+
+			void on_contact (Geometry::ContactPhase phase, Geometry::ContactPair const& pair) final
+			{
+				auto first  = this->find_object(pair.first);
+				auto second = this->find_object(pair.second);
+
+				if (!first || !second)
+					return;
+
+				report_contact (phase, pair.trigger, *first, *second);
+				report_contact (phase, pair.trigger, *second, *first);
+			}
+
 		public:
-			Scene (Generic::Engine& engine) noexcept :
-				myEngine (engine)
-			{}
+			Scene (Generic::Engine& engine) :
+				myEngine   (engine),
+				myWorld	   (std::make_shared <Geometry::World>()),
+				myWorld2D  (std::make_shared <Geometry::World2D>()),
+				myWorldF   (std::make_shared <Geometry::WorldF>()),
+				myWorld2DF (std::make_shared <Geometry::World2DF>())
+			{
+				for_each_world([this] (auto& world) {
+					world.set_contact_listener(this);
+				});
+			}
 
 			Scene(Scene&&)      = delete;
 			Scene(Scene const&) = delete;
@@ -139,8 +181,25 @@ namespace Coli
 				this->start_all();
 			}
 
-			void on_update(float time) final {
+			/* the worlds are stepped by the fixed time, the rest of the frame time waits in the accumulator */
+			void on_update(float time) final 
+			{
 				this->update_all(time);
+
+				myStepAccumulator += time;
+
+				for (size_t i = 0; i < max_steps_per_update && myStepAccumulator >= myFixedTimeStep; ++i)
+				{
+					for_each_world([this] (auto& world) {
+						world.step(myFixedTimeStep);
+					});
+
+					myStepAccumulator -= myFixedTimeStep;
+				}
+
+				/* a long frame must not make the next ones catch up with it */
+				if (myStepAccumulator >= myFixedTimeStep)
+					myStepAccumulator = std::fmod(myStepAccumulator, myFixedTimeStep);
 			}
 
 			void on_late_update(float time) final {
@@ -151,8 +210,60 @@ namespace Coli
 				this->render_all();
 			}
 
+			/* the components of either precision are simulated in a world of their own, an empty world steps for next to nothing */
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
+			_NODISCARD std::weak_ptr <Geometry::BasicWorld <_Use2D, _ScalarTy>> get_world() noexcept 
+			{
+				if constexpr (std::same_as <_ScalarTy, float>)
+				{
+					if constexpr (_Use2D)
+						return myWorld2DF;
+					else
+						return myWorldF;
+				}
+				else
+				{
+					if constexpr (_Use2D)
+						return myWorld2D;
+					else
+						return myWorld;
+				}
+			}
+
+			void set_fixed_time_step (float time) noexcept {
+				myFixedTimeStep = time > 0 ? time : default_fixed_time_step;
+			}
+
+			_NODISCARD float get_fixed_time_step() const noexcept {
+				return myFixedTimeStep;
+			}
+
+			/* the part of the next fixed step which has already passed, renders blend the transforms by it */
+			_NODISCARD float get_step_alpha() const noexcept {
+				return myStepAccumulator / myFixedTimeStep;
+			}
+
+			static constexpr float  default_fixed_time_step = 1.f / 60.f;
+			static constexpr size_t max_steps_per_update	= 8;
+
 		private:
+			void for_each_world (auto&& fn)
+			{
+				fn (*myWorld);
+				fn (*myWorld2D);
+				fn (*myWorldF);
+				fn (*myWorld2DF);
+			}
+
 			Generic::Engine& myEngine;
+
+			float myFixedTimeStep	= default_fixed_time_step;
+			float myStepAccumulator = 0;
+
+			std::shared_ptr <Geometry::World>	 myWorld;
+			std::shared_ptr <Geometry::World2D>	 myWorld2D;
+			std::shared_ptr <Geometry::WorldF>	 myWorldF;
+			std::shared_ptr <Geometry::World2DF> myWorld2DF;
 		};
 	}
 }
\ No newline at end of file
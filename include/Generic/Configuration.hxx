@@ -11,6 +11,9 @@ namespace Coli
 	{
 		struct Configuration {
 			Graphics::Window::Configuration windowConfig = {};
+
+			/* the loaded meshes are reordered for the vertex cache */
+			bool optimizeMeshes = false;
 		};
 	}
 }
@@ -22,12 +25,14 @@ namespace nlohmann
 	{
 	private:
 		struct Keys {
-			static constexpr std::string_view window = "window";
+			static constexpr std::string_view window   = "window";
+			static constexpr std::string_view optimize = "optimizeMeshes";
 		};
 
 	public:
 		static void to_json(json& j, Coli::Generic::Configuration const& val) {
-			j [Keys::window] = val.windowConfig;
+			j [Keys::window]   = val.windowConfig;
+			j [Keys::optimize] = val.optimizeMeshes;
 		}
 
 		static void from_json(const json& j, Coli::Generic::Configuration& val)
@@ -37,7 +42,14 @@ namespace nlohmann
 			decltype (val.windowConfig) tempWindowConfig;
 			try_fill (j, tempWindowConfig, Keys::window);
 
-			val.windowConfig = tempWindowConfig;
+			/* the configurations saved before the flag keep it off */
+			decltype (val.optimizeMeshes) tempOptimizeMeshes = false;
+
+			if (j.contains(Keys::optimize))
+				try_fill (j, tempOptimizeMeshes, Keys::optimize);
+
+			val.windowConfig   = tempWindowConfig;
+			val.optimizeMeshes = tempOptimizeMeshes;
 		}
 	};
 }
\ No newline at end of file
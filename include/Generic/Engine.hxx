@@ -25,6 +25,7 @@ namespace Coli
 				myGameSystem  = std::make_unique <GameSystem> (*this);
 
 				auto const configuration = myFileSystem->load_config();
+				myFileSystem->set_mesh_optimization(configuration.optimizeMeshes);
 
 				myGraphicSystem = std::make_unique <GraphicSystem>(configuration.windowConfig);
 
@@ -49,6 +50,10 @@ namespace Coli
 				return myTimeManager;
 			}
 
+			_NODISCARD GraphicSystem const& get_graphic_system() const noexcept {
+				return *myGraphicSystem;
+			}
+
 			_NODISCARD GameSystem const& get_game_system() const noexcept {
 				return *myGameSystem;
 			}
@@ -79,8 +84,9 @@ namespace Coli
 
 			void run()
 			{
-				auto& gameSystem = *myGameSystem;
-				auto& window     = myGraphicSystem->get_window();
+				auto& gameSystem    = *myGameSystem;
+				auto& graphicSystem = *myGraphicSystem;
+				auto& window        = graphicSystem.get_window();
 
 				while (myRunningFlag)
 				{
@@ -89,6 +95,7 @@ namespace Coli
 					gameSystem.update(deltaTime);
 					gameSystem.late_update(deltaTime);
 					gameSystem.render();
+					graphicSystem.render();
 
 					myTimeManager.update();
 					window.update();
@@ -107,6 +114,8 @@ namespace Coli
 				cfg.windowConfig.height = windowHeight;
 				cfg.windowConfig.title = myApplicationName;
 
+				cfg.optimizeMeshes = myFileSystem->has_mesh_optimization();
+
 				myFileSystem->save_config(cfg);
 			}
 
@@ -8,6 +8,9 @@
 #include "../File/AssetLoader.hxx"
 #include "../File/MeshLoader.hxx"
 
+#include "../Graphics/ProgramCache.hxx"
+#include "../Graphics/MeshCache.hxx"
+
 namespace Coli
 {
 	namespace Generic
@@ -33,6 +36,8 @@ namespace Coli
 				myAssetLoader (rootPath + Subdirectories::assets)
 			{
 				gen_pathes(rootPath);
+
+				Graphics::ProgramCache::set_directory(rootPath + Subdirectories::shaders);
 			}
 
 			FileSystem(FileSystem&&)	  = delete;
@@ -63,6 +68,27 @@ namespace Coli
 				return myMeshLoader.load<_VertexTy>(name);
 			}
 
+			/* the uploaded mesh of the asset, it is read from the disk only when no drawable holds it */
+			template <Detail::Vertex _VertexTy, Detail::PackedFormat _FormatTy = Graphics::DefaultVertexFormat <_VertexTy>>
+			_NODISCARD std::shared_ptr <Detail::MeshContext <_VertexTy, _FormatTy>> acquire_mesh (std::string_view name)
+			{
+				return Graphics::MeshCache<_VertexTy, _FormatTy>::acquire(name, [this, name] {
+					return myMeshLoader.load<_VertexTy>(name);
+				});
+			}
+
+			void set_mesh_optimization (bool enabled) noexcept {
+				myMeshLoader.set_optimization(enabled);
+			}
+
+			_NODISCARD bool has_mesh_optimization() const noexcept {
+				return myMeshLoader.has_optimization();
+			}
+
+			_NODISCARD std::optional <Geometry::IndexStatistics> const& get_mesh_statistics() const noexcept {
+				return myMeshLoader.get_statistics();
+			}
+
 			_NODISCARD Configuration load_config () 
 			{
 				Configuration cfg = {};
@@ -85,11 +111,12 @@ namespace Coli
 			};
 
 			struct Subdirectories {
-				static inline const std::string mesh   = "mesh/";
-				static inline const std::string assets = "assets/";
+				static inline const std::string mesh    = "mesh/";
+				static inline const std::string assets  = "assets/";
+				static inline const std::string shaders = "shaders/";
 
 				static inline const std::unordered_set <std::string_view> all = {
-					mesh, assets
+					mesh, assets, shaders
 				};
 			};
 
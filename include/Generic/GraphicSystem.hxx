@@ -35,6 +35,15 @@ namespace Coli
 				return myWindow;
 			}
 
+			_NODISCARD Graphics::Renderer const& get_renderer() const noexcept {
+				return *myRenderer;
+			}
+
+			/* draws everything the scene submitted during its render */
+			void render() {
+				myRenderer->flush();
+			}
+
 		private:
 			Graphics::Context  myContext;
 			Graphics::Window   myWindow;
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "GlmHelper.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* how a volume relates to the bounds tested against it */
+		enum class Containment {
+			outside,
+			intersects,
+			inside
+		};
+
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicBounds
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+
+		public:
+			constexpr BasicBounds() noexcept = default;
+
+			constexpr BasicBounds (vector_type const& lower, vector_type const& upper) noexcept :
+				min (lower),
+				max (upper)
+			{}
+
+			_NODISCARD static BasicBounds from_sphere (vector_type const& center, _ScalarTy radius) noexcept {
+				return { center - radius, center + radius };
+			}
+
+			_NODISCARD bool overlaps (BasicBounds const& other) const noexcept
+			{
+				for (glm::length_t i = 0; i < vector_type::length(); ++i)
+					if (max[i] < other.min[i] || other.max[i] < min[i])
+						return false;
+
+				return true;
+			}
+
+			_NODISCARD bool contains (BasicBounds const& other) const noexcept
+			{
+				for (glm::length_t i = 0; i < vector_type::length(); ++i)
+					if (other.min[i] < min[i] || max[i] < other.max[i])
+						return false;
+
+				return true;
+			}
+
+			_NODISCARD BasicBounds merged (BasicBounds const& other) const noexcept {
+				return { glm::min(min, other.min), glm::max(max, other.max) };
+			}
+
+			_NODISCARD BasicBounds expanded (_ScalarTy margin) const noexcept {
+				return { min - margin, max + margin };
+			}
+
+			_NODISCARD BasicBounds swept (vector_type const& displacement) const noexcept {
+				return { min + glm::min(displacement, vector_type{ 0 }),
+						 max + glm::max(displacement, vector_type{ 0 }) };
+			}
+
+			_NODISCARD vector_type get_center() const noexcept {
+				return (min + max) / _ScalarTy{ 2 };
+			}
+
+			_NODISCARD vector_type get_extents() const noexcept {
+				return (max - min) / _ScalarTy{ 2 };
+			}
+
+			/* perimeter in 2D and surface area in 3D, used as the tree insertion cost */
+			_NODISCARD _ScalarTy get_cost() const noexcept
+			{
+				auto const size = max - min;
+
+				if constexpr (_Use2D)
+					return _ScalarTy{ 2 } * (size.x + size.y);
+				else
+					return _ScalarTy{ 2 } * (size.x * size.y + size.y * size.z + size.z * size.x);
+			}
+
+			_NODISCARD std::optional <_ScalarTy> intersect_ray (
+				vector_type const& origin,
+				vector_type const& inverseDirection,
+				_ScalarTy maxDistance
+			) const noexcept
+			{
+				_ScalarTy near = 0;
+				_ScalarTy far  = maxDistance;
+
+				for (glm::length_t i = 0; i < vector_type::length(); ++i)
+				{
+					auto first  = (min[i] - origin[i]) * inverseDirection[i];
+					auto second = (max[i] - origin[i]) * inverseDirection[i];
+
+					if (first > second)
+						std::swap(first, second);
+
+					near = std::max(near, first);
+					far  = std::min(far,  second);
+
+					if (near > far)
+						return std::nullopt;
+				}
+
+				return near;
+			}
+
+			vector_type min { 0 };
+			vector_type max { 0 };
+		};
+
+		using Bounds   = BasicBounds <false>;
+		using Bounds2D = BasicBounds <true>;
+
+		using BoundsF   = BasicBounds <false, float>;
+		using Bounds2DF = BasicBounds <true,  float>;
+	}
+}
\ No newline at end of file
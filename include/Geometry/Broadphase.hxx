@@ -0,0 +1,482 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Bounds.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		template <class _Ty, size_t _Capacity>
+		class GrowableStack final
+		{
+		public:
+			GrowableStack() noexcept = default;
+
+			GrowableStack(GrowableStack&&)	    = delete;
+			GrowableStack(GrowableStack const&) = delete;
+
+			GrowableStack& operator=(GrowableStack&&)	   = delete;
+			GrowableStack& operator=(GrowableStack const&) = delete;
+
+			void push (_Ty const& value)
+			{
+				if (mySize < _Capacity)
+					myArray[mySize] = value;
+
+				else if (mySize - _Capacity < myHeap.size())
+					myHeap[mySize - _Capacity] = value;
+
+				else
+					myHeap.push_back(value);
+
+				++mySize;
+			}
+
+			_NODISCARD _Ty pop() noexcept
+			{
+				--mySize;
+
+				if (mySize < _Capacity)
+					return myArray[mySize];
+				else
+					return myHeap[mySize - _Capacity];
+			}
+
+			_NODISCARD bool empty() const noexcept {
+				return mySize == 0;
+			}
+
+		private:
+			std::array  <_Ty, _Capacity> myArray;
+			std::vector <_Ty>			 myHeap;
+
+			size_t mySize = 0;
+		};
+	}
+
+	namespace Geometry
+	{
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicBroadphase
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using bounds_type = BasicBounds <_Use2D, _ScalarTy>;
+
+			static void x_invalid_proxy() {
+				throw std::invalid_argument("Invalid broadphase proxy");
+			}
+
+		public:
+			static constexpr size_t null_proxy = std::numeric_limits <size_t>::max();
+
+			static constexpr _ScalarTy fat_margin		  = _ScalarTy(0.1);
+			static constexpr _ScalarTy displacement_scale = _ScalarTy(4.0);
+
+		private:
+			using stack_type = Detail::GrowableStack <size_t, 256>;
+
+			struct Node
+			{
+				_NODISCARD bool is_leaf() const noexcept {
+					return left == null_proxy;
+				}
+
+				bounds_type bounds;
+				size_t		userData = 0;
+
+				size_t parent = null_proxy;
+				size_t left   = null_proxy;
+				size_t right  = null_proxy;
+
+				/* -1 marks a node which lays in the free list */
+				int height = -1;
+			};
+
+			_NODISCARD size_t allocate_node()
+			{
+				size_t index;
+
+				if (myFreeList != null_proxy) {
+					index	   = myFreeList;
+					myFreeList = myNodes[index].parent;
+				}
+				else {
+					index = myNodes.size();
+					myNodes.emplace_back();
+				}
+
+				myNodes[index] = Node{};
+				myNodes[index].height = 0;
+
+				return index;
+			}
+
+			void free_node (size_t index) noexcept
+			{
+				myNodes[index].parent = myFreeList;
+				myNodes[index].height = -1;
+
+				myFreeList = index;
+			}
+
+			void fix_upwards (size_t index) noexcept
+			{
+				while (index != null_proxy)
+				{
+					index = balance(index);
+
+					auto& node  = myNodes[index];
+					auto& left  = myNodes[node.left];
+					auto& right = myNodes[node.right];
+
+					node.height = 1 + std::max(left.height, right.height);
+					node.bounds = left.bounds.merged(right.bounds);
+
+					index = node.parent;
+				}
+			}
+
+			void insert_leaf (size_t leaf)
+			{
+				if (myRoot == null_proxy) {
+					myRoot = leaf;
+					myNodes[leaf].parent = null_proxy;
+					return;
+				}
+
+				auto const leafBounds = myNodes[leaf].bounds;
+				auto	   index	  = myRoot;
+
+				while (!myNodes[index].is_leaf())
+				{
+					auto const& node = myNodes[index];
+
+					auto const area		    = node.bounds.get_cost();
+					auto const combinedArea = node.bounds.merged(leafBounds).get_cost();
+
+					auto const cost			   = _ScalarTy{ 2 } * combinedArea;
+					auto const inheritanceCost = _ScalarTy{ 2 } * (combinedArea - area);
+
+					auto const descend_cost = [&] (size_t child) noexcept
+					{
+						auto const& childNode = myNodes[child];
+						auto const  merged	  = leafBounds.merged(childNode.bounds).get_cost();
+
+						if (childNode.is_leaf())
+							return merged + inheritanceCost;
+						else
+							return merged - childNode.bounds.get_cost() + inheritanceCost;
+					};
+
+					auto const leftCost  = descend_cost(node.left);
+					auto const rightCost = descend_cost(node.right);
+
+					if (cost < leftCost && cost < rightCost)
+						break;
+
+					index = leftCost < rightCost ? node.left : node.right;
+				}
+
+				auto const sibling   = index;
+				auto const oldParent = myNodes[sibling].parent;
+				auto const newParent = allocate_node();
+
+				auto& parentNode = myNodes[newParent];
+
+				parentNode.parent = oldParent;
+				parentNode.bounds = leafBounds.merged(myNodes[sibling].bounds);
+				parentNode.height = myNodes[sibling].height + 1;
+				parentNode.left   = sibling;
+				parentNode.right  = leaf;
+
+				if (oldParent != null_proxy)
+				{
+					if (myNodes[oldParent].left == sibling)
+						myNodes[oldParent].left = newParent;
+					else
+						myNodes[oldParent].right = newParent;
+				}
+				else
+					myRoot = newParent;
+
+				myNodes[sibling].parent = newParent;
+				myNodes[leaf].parent	= newParent;
+
+				fix_upwards (myNodes[leaf].parent);
+			}
+
+			void remove_leaf (size_t leaf) noexcept
+			{
+				if (leaf == myRoot) {
+					myRoot = null_proxy;
+					return;
+				}
+
+				auto const parent	   = myNodes[leaf].parent;
+				auto const grandParent = myNodes[parent].parent;
+				auto const sibling	   = myNodes[parent].left == leaf ? myNodes[parent].right : myNodes[parent].left;
+
+				if (grandParent != null_proxy)
+				{
+					if (myNodes[grandParent].left == parent)
+						myNodes[grandParent].left = sibling;
+					else
+						myNodes[grandParent].right = sibling;
+
+					myNodes[sibling].parent = grandParent;
+					free_node (parent);
+
+					fix_upwards (grandParent);
+				}
+				else {
+					myRoot = sibling;
+					myNodes[sibling].parent = null_proxy;
+
+					free_node (parent);
+				}
+			}
+
+			/* an AVL rotation which promotes the higher child of the node, returns the new subtree root */
+			_NODISCARD size_t balance (size_t top) noexcept
+			{
+				auto& a = myNodes[top];
+
+				if (a.is_leaf() || a.height < 2)
+					return top;
+
+				auto const b = a.left;
+				auto const c = a.right;
+
+				auto const difference = myNodes[c].height - myNodes[b].height;
+
+				auto const rotate = [&] (size_t high, size_t low, bool highIsRight) noexcept
+				{
+					auto& h = myNodes[high];
+
+					auto const f = h.left;
+					auto const g = h.right;
+
+					h.left   = top;
+					h.parent = a.parent;
+					a.parent = high;
+
+					if (h.parent != null_proxy)
+					{
+						if (myNodes[h.parent].left == top)
+							myNodes[h.parent].left = high;
+						else
+							myNodes[h.parent].right = high;
+					}
+					else
+						myRoot = high;
+
+					auto const keep = myNodes[f].height > myNodes[g].height ? f : g;
+					auto const give = keep == f ? g : f;
+
+					h.right = keep;
+
+					if (highIsRight)
+						a.right = give;
+					else
+						a.left  = give;
+
+					myNodes[give].parent = top;
+
+					a.bounds = myNodes[low].bounds.merged(myNodes[give].bounds);
+					h.bounds = a.bounds.merged(myNodes[keep].bounds);
+
+					a.height = 1 + std::max(myNodes[low].height,  myNodes[give].height);
+					h.height = 1 + std::max(a.height, myNodes[keep].height);
+
+					return high;
+				};
+
+				if (difference > 1)
+					return rotate(c, b, true);
+
+				if (difference < -1)
+					return rotate(b, c, false);
+
+				return top;
+			}
+
+			void verify_proxy (size_t proxy) const
+			{
+				if (proxy >= myNodes.size() || !myNodes[proxy].is_leaf() || myNodes[proxy].height < 0)
+					x_invalid_proxy();
+			}
+
+		public:
+			BasicBroadphase() noexcept = default;
+
+			BasicBroadphase(BasicBroadphase&&)	    = delete;
+			BasicBroadphase(BasicBroadphase const&) = delete;
+
+			BasicBroadphase& operator=(BasicBroadphase&&)	   = delete;
+			BasicBroadphase& operator=(BasicBroadphase const&) = delete;
+
+			_NODISCARD size_t insert (bounds_type const& bounds, size_t userData)
+			{
+				auto const proxy = allocate_node();
+				auto&	   node  = myNodes[proxy];
+
+				node.bounds   = bounds.expanded(fat_margin);
+				node.userData = userData;
+
+				insert_leaf (proxy);
+				++myProxiesCount;
+
+				return proxy;
+			}
+
+			void remove (size_t proxy)
+			{
+				verify_proxy (proxy);
+
+				remove_leaf (proxy);
+				free_node (proxy);
+
+				--myProxiesCount;
+			}
+
+			/* returns true if the proxy left its fat bounds and was reinserted */
+			bool move (size_t proxy, bounds_type const& bounds, vector_type const& displacement = vector_type{ 0 })
+			{
+				verify_proxy (proxy);
+
+				if (myNodes[proxy].bounds.contains(bounds))
+					return false;
+
+				remove_leaf (proxy);
+
+				myNodes[proxy].bounds = bounds.expanded(fat_margin).swept(displacement * displacement_scale);
+				insert_leaf (proxy);
+
+				return true;
+			}
+
+			_NODISCARD bounds_type const& get_fat_bounds (size_t proxy) const noexcept {
+				return myNodes[proxy].bounds;
+			}
+
+			_NODISCARD size_t get_user_data (size_t proxy) const noexcept {
+				return myNodes[proxy].userData;
+			}
+
+			void set_user_data (size_t proxy, size_t userData) noexcept {
+				myNodes[proxy].userData = userData;
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return myProxiesCount;
+			}
+
+			_NODISCARD bool empty() const noexcept {
+				return myProxiesCount == 0;
+			}
+
+			_NODISCARD int get_height() const noexcept {
+				return myRoot == null_proxy ? 0 : myNodes[myRoot].height;
+			}
+
+			/* the callback receives the proxy and returns false to stop the query */
+			template <std::invocable <size_t> _FnTy>
+			void query (bounds_type const& bounds, _FnTy&& fn) const
+			{
+				if (myRoot == null_proxy)
+					return;
+
+				stack_type stack;
+				stack.push(myRoot);
+
+				while (!stack.empty())
+				{
+					auto const& node = myNodes[stack.pop()];
+
+					if (!node.bounds.overlaps(bounds))
+						continue;
+
+					if (node.is_leaf()) {
+						if (!fn(static_cast<size_t>(&node - myNodes.data())))
+							return;
+					}
+					else {
+						stack.push(node.left);
+						stack.push(node.right);
+					}
+				}
+			}
+
+			/* the callback receives the proxy and the current clip distance and returns
+			   a new clip distance, returning zero terminates the cast */
+			template <std::invocable <size_t, _ScalarTy> _FnTy>
+			void raycast (
+				vector_type const& origin,
+				vector_type const& direction,
+				_ScalarTy maxDistance,
+				_FnTy&& fn
+			) const
+			{
+				sweep (origin, direction, maxDistance, _ScalarTy{ 0 }, std::forward<_FnTy>(fn));
+			}
+
+			/* the same as the raycast but for a sphere of the radius moving along the direction */
+			template <std::invocable <size_t, _ScalarTy> _FnTy>
+			void sweep (
+				vector_type const& origin,
+				vector_type const& direction,
+				_ScalarTy maxDistance,
+				_ScalarTy radius,
+				_FnTy&& fn
+			) const
+			{
+				if (myRoot == null_proxy)
+					return;
+
+				auto const inverseDirection = _ScalarTy{ 1 } / direction;
+
+				stack_type stack;
+				stack.push(myRoot);
+
+				while (!stack.empty())
+				{
+					auto const& node = myNodes[stack.pop()];
+
+					if (!node.bounds.expanded(radius).intersect_ray(origin, inverseDirection, maxDistance))
+						continue;
+
+					if (node.is_leaf())
+					{
+						_ScalarTy const clip = fn(static_cast<size_t>(&node - myNodes.data()), maxDistance);
+
+						if (clip == 0)
+							return;
+
+						if (clip > 0)
+							maxDistance = std::min(maxDistance, clip);
+					}
+					else {
+						stack.push(node.left);
+						stack.push(node.right);
+					}
+				}
+			}
+
+		private:
+			std::vector <Node> myNodes;
+
+			size_t myRoot		  = null_proxy;
+			size_t myFreeList	  = null_proxy;
+			size_t myProxiesCount = 0;
+		};
+
+		using Broadphase   = BasicBroadphase <false>;
+		using Broadphase2D = BasicBroadphase <true>;
+
+		using BroadphaseF   = BasicBroadphase <false, float>;
+		using Broadphase2DF = BasicBroadphase <true,  float>;
+	}
+}
\ No newline at end of file
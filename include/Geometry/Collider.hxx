@@ -4,50 +4,123 @@
 #include "../Utility.hxx"
 
 #include "Transform.hxx"
+#include "Bounds.hxx"
+#include "Gjk.hxx"
 
 namespace Coli
 {
 	namespace Geometry
 	{
-		template <bool _Use2D>
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
 		class BasicCollision
 		{
-			using vector_type = glm::vec <_Use2D ? 2 : 3, double>;
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
 
 		public:
-			constexpr BasicCollision() noexcept = default;
-	
 			vector_type direction;
 			vector_type normal;
-			double		overlap;
+			_ScalarTy	overlap;
 		};
 
 		using Collision   = BasicCollision <false>;
 		using Collision2D = BasicCollision <true>;
+
+		using CollisionF   = BasicCollision <false, float>;
+		using Collision2DF = BasicCollision <true,  float>;
+
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicSweepHit
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+
+		public:
+			_ScalarTy	fraction;
+			vector_type normal;
+		};
+
+		using SweepHit   = BasicSweepHit <false>;
+		using SweepHit2D = BasicSweepHit <true>;
+		using SweepHitF   = BasicSweepHit <false, float>;
+		using SweepHit2DF = BasicSweepHit <true,  float>;
 	}
 
 	namespace Detail
 	{
 		inline namespace SAT
 		{
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class ColliderBase
 			{
-				using vector_type = glm::vec <_Use2D ? 2 : 3, double>;
+				using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
 
 			public:
 				constexpr ColliderBase() noexcept = default;
 
 				constexpr virtual ~ColliderBase() noexcept = default;
 
-				ColliderBase(ColliderBase&&)	  noexcept {}
-				ColliderBase(ColliderBase const&) noexcept {}
+				static constexpr uint32_t all_categories = std::numeric_limits <uint32_t>::max();
 
-				ColliderBase& operator=(ColliderBase&&)		 noexcept { return *this; }
-				ColliderBase& operator=(ColliderBase const&) noexcept { return *this; }
+				ColliderBase(ColliderBase&& other) noexcept :
+					myCategory	  (other.myCategory),
+					myMask		  (other.myMask),
+					myTriggerFlag (other.myTriggerFlag)
+				{}
 
-			protected:
-				_NODISCARD vector_type get_world_position() const noexcept
+				ColliderBase(ColliderBase const& other) noexcept :
+					myCategory	  (other.myCategory),
+					myMask		  (other.myMask),
+					myTriggerFlag (other.myTriggerFlag)
+				{}
+
+				ColliderBase& operator=(ColliderBase&& other) noexcept {
+					myCategory	  = other.myCategory;
+					myMask		  = other.myMask;
+					myTriggerFlag = other.myTriggerFlag;
+					return *this;
+				}
+
+				ColliderBase& operator=(ColliderBase const& other) noexcept {
+					myCategory	  = other.myCategory;
+					myMask		  = other.myMask;
+					myTriggerFlag = other.myTriggerFlag;
+					return *this;
+				}
+
+				/* triggers are only tested for overlapping and never take part in the collision response */
+				void enable_trigger() noexcept {
+					myTriggerFlag = true;
+				}
+
+				void disable_trigger() noexcept {
+					myTriggerFlag = false;
+				}
+
+				_NODISCARD bool is_trigger() const noexcept {
+					return myTriggerFlag;
+				}
+
+				_NODISCARD uint32_t get_collision_category() const noexcept {
+					return myCategory;
+				}
+
+				void set_collision_category (uint32_t category) noexcept {
+					myCategory = category;
+				}
+
+				_NODISCARD uint32_t get_collision_mask() const noexcept {
+					return myMask;
+				}
+
+				void set_collision_mask (uint32_t mask) noexcept {
+					myMask = mask;
+				}
+
+				/* both colliders have to accept the category of each other */
+				_NODISCARD static bool can_interact (ColliderBase const& first, ColliderBase const& second) noexcept {
+					return (first.myCategory & second.myMask) != 0 && (second.myCategory & first.myMask) != 0;
+				}
+
+				_NODISCARD virtual vector_type get_world_position() const noexcept
 				{
 					if (auto transform = myTransform.lock())
 						return transform->get_world_position();
@@ -55,18 +128,49 @@ namespace Coli
 					return vector_type{ 0 };
 				}
 
-				_NODISCARD virtual double get_longest_diagonal() const noexcept = 0;
+				_NODISCARD _ScalarTy get_bounding_radius() const noexcept
+				{
+					auto const diagonal = get_longest_diagonal();
+
+					if (auto transform = myTransform.lock())
+						return diagonal * Detail::max_component(glm::abs(transform->get_world_scale()));
+
+					return diagonal;
+				}
+
+				_NODISCARD Geometry::BasicBounds <_Use2D, _ScalarTy> get_bounds() const noexcept {
+					return Geometry::BasicBounds<_Use2D, _ScalarTy>::from_sphere(get_world_position(), get_bounding_radius());
+				}
+
+				/* finds the first contact of a sphere moving from the origin along the displacement */
+				_NODISCARD virtual std::optional <Geometry::BasicSweepHit <_Use2D, _ScalarTy>>
+				cast_sphere (
+					vector_type const& origin,
+					vector_type const& displacement,
+					_ScalarTy radius
+				) const noexcept = 0;
+
+			protected:
+				_NODISCARD virtual _ScalarTy get_longest_diagonal() const noexcept = 0;
 
 				_NODISCARD virtual std::unordered_set <vector_type>
 				get_axes() const = 0;
 
-				_NODISCARD virtual std::pair <double, double>
+				_NODISCARD virtual std::pair <_ScalarTy, _ScalarTy>
 				get_projection(vector_type const& axis) const noexcept = 0;
+
+				/* the farthest point of the collider in the world space along the direction */
+				_NODISCARD virtual vector_type get_support (vector_type const& direction) const noexcept = 0;
+
+				/* shapes with too many faces for the separating axes test are solved by the GJK and EPA instead */
+				_NODISCARD virtual bool has_axes() const noexcept {
+					return true;
+				}
 				
 			private:
-				_NODISCARD static double find_overlap(
-					std::pair <double, double> const& left,
-					std::pair <double, double> const& right
+				_NODISCARD static _ScalarTy find_overlap(
+					std::pair <_ScalarTy, _ScalarTy> const& left,
+					std::pair <_ScalarTy, _ScalarTy> const& right
 				) noexcept
 				{
 					auto const [leftStart,  leftEnd]  = std::minmax(left.first,  left.second);
@@ -81,8 +185,35 @@ namespace Coli
 					return overlapEnd - overlapStart;
 				}
 
+				_NODISCARD static auto make_support (ColliderBase const& first, ColliderBase const& second) noexcept
+				{
+					return [&first, &second] (vector_type const& direction) noexcept {
+						return first.get_support(direction) - second.get_support(-direction);
+					};
+				}
+
+				_NODISCARD static std::optional <Geometry::BasicCollision<_Use2D, _ScalarTy>>
+				find_support_collision (
+					ColliderBase const& first,
+					ColliderBase const& second,
+					vector_type const& distance
+				) {
+					auto const support = make_support(first, second);
+					auto const simplex = GJK::find_simplex(support, distance);
+
+					if (!simplex)
+						return std::nullopt;
+
+					auto const [normal, overlap] = GJK::find_penetration(support, *simplex);
+
+					if (overlap > 0)
+						return Geometry::BasicCollision<_Use2D, _ScalarTy>{ distance, normal, overlap };
+					else
+						return std::nullopt;
+				}
+
 			public:
-				_NODISCARD static std::optional <Geometry::BasicCollision<_Use2D>>
+				_NODISCARD static std::optional <Geometry::BasicCollision<_Use2D, _ScalarTy>>
 				find_collision (
 					ColliderBase const& first,
 					ColliderBase const& second
@@ -92,6 +223,9 @@ namespace Coli
 
 					if (glm::length2(distance) <= maxDiagonal * maxDiagonal)
 					{
+						if (!first.has_axes() || !second.has_axes())
+							return find_support_collision(first, second, distance);
+
 						auto	   axes      = first.get_axes();
 						auto const otherAxes = second.get_axes();
 
@@ -101,7 +235,7 @@ namespace Coli
 							axes.emplace (glm::normalize(distance));
 
 						vector_type normal;
-						double minOverlap = std::numeric_limits<double>::infinity();
+						_ScalarTy minOverlap = std::numeric_limits<_ScalarTy>::infinity();
 
 						for (auto const& axis : axes)
 						{
@@ -117,18 +251,45 @@ namespace Coli
 								return std::nullopt;
 						}
 
-						return Geometry::BasicCollision<_Use2D>{ distance, normal, minOverlap };
+						return Geometry::BasicCollision<_Use2D, _ScalarTy>{ distance, normal, minOverlap };
 					} 
 					else
 						return std::nullopt;
 				}
 
-				_NODISCARD std::optional <Geometry::BasicCollision<_Use2D>> 
+				_NODISCARD std::optional <Geometry::BasicCollision<_Use2D, _ScalarTy>> 
 				find_collision (ColliderBase const& other) {
 					return find_collision(*this, other);
 				}
 
-				void bind_transform(std::weak_ptr<Geometry::BasicTransform<_Use2D> const> transform) noexcept {
+				/* the same test as the collision search but stops at the first separating axis */
+				_NODISCARD static bool overlaps (
+					ColliderBase const& first,
+					ColliderBase const& second
+				) {
+					auto const distance    = first.get_world_position() - second.get_world_position();
+					auto const maxDiagonal = first.get_longest_diagonal() + second.get_longest_diagonal();
+
+					if (glm::length2(distance) > maxDiagonal * maxDiagonal)
+						return false;
+
+					if (!first.has_axes() || !second.has_axes())
+						return GJK::find_simplex(make_support(first, second), distance).has_value();
+
+					auto const separates = [&] (vector_type const& axis) {
+						return find_overlap(first.get_projection(axis), second.get_projection(axis)) <= 0;
+					};
+
+					auto const firstAxes  = first.get_axes();
+					auto const secondAxes = second.get_axes();
+
+					if (firstAxes.empty() && secondAxes.empty())
+						return glm::length2(distance) == 0 || !separates(glm::normalize(distance));
+
+					return std::ranges::none_of(firstAxes, separates) && std::ranges::none_of(secondAxes, separates);
+				}
+
+				void bind_transform(std::weak_ptr<Geometry::BasicTransform<_Use2D, _ScalarTy> const> transform) noexcept {
 					myTransform.swap(transform);
 				}
 
@@ -137,7 +298,13 @@ namespace Coli
 					return !myTransform.expired();
 				}
 
-				std::weak_ptr <Geometry::BasicTransform <_Use2D> const> myTransform;
+				std::weak_ptr <Geometry::BasicTransform <_Use2D, _ScalarTy> const> myTransform;
+
+			private:
+				uint32_t myCategory = 1;
+				uint32_t myMask		= all_categories;
+
+				bool myTriggerFlag = false;
 			};
 		}
 	}
@@ -146,12 +313,12 @@ namespace Coli
 	{
 		inline namespace SAT
 		{
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicBoxCollider :
-				public Detail::SAT::ColliderBase<_Use2D>
+				public Detail::SAT::ColliderBase<_Use2D, _ScalarTy>
 			{
-				using vector_type  = glm::vec <_Use2D ? 2 : 3, double>;
-				using rotator_type = std::conditional_t <_Use2D, double, glm::dquat>;
+				using vector_type  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+				using rotator_type = Detail::rotator_t <_Use2D, _ScalarTy>;
 
 			public:
 				BasicBoxCollider () noexcept = default;
@@ -160,7 +327,7 @@ namespace Coli
 					vector_type const& size,
 					rotator_type const& rotator
 				) noexcept :
-					myHalfSizes (size / 2.0),
+					myHalfSizes (size / _ScalarTy{ 2 }),
 					myRotation  (rotator),
 					myDiagonal  (glm::length (myHalfSizes))
 				{}
@@ -195,9 +362,71 @@ namespace Coli
 						return myRotation;
 				}
 
-				_NODISCARD double get_longest_diagonal() const noexcept final {
+				_NODISCARD _ScalarTy get_longest_diagonal() const noexcept final {
 					return myDiagonal;
 				}
+
+				_NODISCARD std::optional <Geometry::BasicSweepHit <_Use2D, _ScalarTy>>
+				cast_sphere (
+					vector_type const& origin,
+					vector_type const& displacement,
+					_ScalarTy radius
+				) const noexcept final
+				{
+					auto const rotator = get_rotatator();
+					auto	   extents = myHalfSizes;
+
+					if (auto transform = myTransform.lock())
+						extents *= glm::abs(transform->get_world_scale());
+
+					extents += radius;
+
+					auto const start = Detail::unrotate_vector(rotator, origin - this->get_world_position());
+					auto const delta = Detail::unrotate_vector(rotator, displacement);
+
+					_ScalarTy	  enter = 0;
+					_ScalarTy	  leave = 1;
+					glm::length_t axis  = -1;
+
+					for (glm::length_t i = 0; i < vector_type::length(); ++i)
+					{
+						if (delta[i] == 0) {
+							if (glm::abs(start[i]) > extents[i])
+								return std::nullopt;
+
+							continue;
+						}
+
+						auto first  = (-extents[i] - start[i]) / delta[i];
+						auto second = ( extents[i] - start[i]) / delta[i];
+
+						if (first > second)
+							std::swap(first, second);
+
+						if (first > enter) {
+							enter = first;
+							axis  = i;
+						}
+
+						leave = std::min(leave, second);
+
+						if (enter > leave)
+							return std::nullopt;
+					}
+
+					vector_type normal { 0 };
+
+					if (axis >= 0)
+						normal[axis] = delta[axis] > 0 ? _ScalarTy{ -1 } : _ScalarTy{ 1 };
+
+					else if (glm::length2(displacement) > 0)
+						return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ 0, -glm::normalize(displacement) };
+
+					else
+						normal[0] = 1.0;
+
+					return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ enter, Detail::rotate_vector(rotator, normal) };
+				}
 				
 				_NODISCARD std::unordered_set <vector_type>
 				get_axes() const final 
@@ -206,18 +435,18 @@ namespace Coli
 
 					if constexpr (_Use2D)
 						return {
-							glm::dvec2{ glm::cos(glm::radians(rotator)), 0 },
-							glm::dvec2{ 0, glm::sin(glm::radians(rotator)) }
+							glm::vec <2, _ScalarTy>{ glm::cos(glm::radians(rotator)), 0 },
+							glm::vec <2, _ScalarTy>{ 0, glm::sin(glm::radians(rotator)) }
 						};
 					else
 						return {
-							glm::rotate (rotator, glm::dvec3{ 1, 0, 0 }),
-							glm::rotate (rotator, glm::dvec3{ 0, 1, 0 }),
-							glm::rotate (rotator, glm::dvec3{ 0, 0, 1 })
+							glm::rotate (rotator, glm::vec <3, _ScalarTy>{ 1, 0, 0 }),
+							glm::rotate (rotator, glm::vec <3, _ScalarTy>{ 0, 1, 0 }),
+							glm::rotate (rotator, glm::vec <3, _ScalarTy>{ 0, 0, 1 })
 						};
 				}
 
-				_NODISCARD std::pair <double, double> 
+				_NODISCARD std::pair <_ScalarTy, _ScalarTy> 
 				get_projection (vector_type const& axis) const noexcept final
 				{
 					auto const projCenter = glm::dot(this->get_world_position(), axis);
@@ -228,7 +457,7 @@ namespace Coli
 						boxAxes *= transform->get_world_scale();
 
 					if constexpr (_Use2D) {
-						boxAxes *= glm::dvec2{ glm::cos(glm::radians(rotator)), glm::sin(glm::radians(rotator)) };
+						boxAxes *= glm::vec <2, _ScalarTy>{ glm::cos(glm::radians(rotator)), glm::sin(glm::radians(rotator)) };
 						boxAxes =  glm::abs(boxAxes);
 
 						return {
@@ -238,10 +467,10 @@ namespace Coli
 					} 
 					else {
 						boxAxes = glm::rotate (rotator, boxAxes);
-						boxAxes = glm::abs (glm::dvec3 {
-							glm::dot (glm::dvec3{ boxAxes.x, 0, 0 }, axis),
-							glm::dot (glm::dvec3{ 0, boxAxes.y, 0 }, axis),
-							glm::dot (glm::dvec3{ 0, 0, boxAxes.z }, axis)
+						boxAxes = glm::abs (glm::vec <3, _ScalarTy> {
+							glm::dot (glm::vec <3, _ScalarTy>{ boxAxes.x, 0, 0 }, axis),
+							glm::dot (glm::vec <3, _ScalarTy>{ 0, boxAxes.y, 0 }, axis),
+							glm::dot (glm::vec <3, _ScalarTy>{ 0, 0, boxAxes.z }, axis)
 						});
 
 						return {
@@ -251,26 +480,42 @@ namespace Coli
 					}
 				}
 
+				_NODISCARD vector_type get_support (vector_type const& direction) const noexcept final
+				{
+					auto const rotator = get_rotatator();
+					auto const local   = Detail::unrotate_vector(rotator, direction);
+					auto	   extents = myHalfSizes;
+
+					if (auto transform = myTransform.lock())
+						extents *= glm::abs(transform->get_world_scale());
+
+					for (glm::length_t i = 0; i < vector_type::length(); ++i)
+						if (local[i] < 0)
+							extents[i] = -extents[i];
+
+					return this->get_world_position() + Detail::rotate_vector(rotator, extents);
+				}
+
 				friend struct nlohmann::adl_serializer <BasicBoxCollider>;
 
-				using Detail::SAT::ColliderBase <_Use2D>::myTransform;
+				using Detail::SAT::ColliderBase <_Use2D, _ScalarTy>::myTransform;
 
 				rotator_type myRotation;
 				vector_type  myHalfSizes;
-				double	     myDiagonal;
+				_ScalarTy	 myDiagonal;
 				bool		 myIgnoreRotationFlag;
 			};
 
-			template <bool _Use2D>
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
 			class BasicRoundCollider :
-				public Detail::SAT::ColliderBase <_Use2D>
+				public Detail::SAT::ColliderBase <_Use2D, _ScalarTy>
 			{
-				using vector_type = glm::vec <_Use2D ? 2 : 3, double>;
+				using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
 
 			public:
 				BasicRoundCollider() noexcept = default;
 
-				BasicRoundCollider (double radius) noexcept :
+				BasicRoundCollider (_ScalarTy radius) noexcept :
 					myRadius (radius)
 				{}
 
@@ -281,16 +526,54 @@ namespace Coli
 				BasicRoundCollider& operator=(BasicRoundCollider const&) noexcept = default;
 
 			private:
-				_NODISCARD double get_longest_diagonal() const noexcept final {
+				_NODISCARD _ScalarTy get_longest_diagonal() const noexcept final {
 					return myRadius;
 				}
 
+				_NODISCARD std::optional <Geometry::BasicSweepHit <_Use2D, _ScalarTy>>
+				cast_sphere (
+					vector_type const& origin,
+					vector_type const& displacement,
+					_ScalarTy radius
+				) const noexcept final
+				{
+					auto const relative = origin - this->get_world_position();
+					auto const distance = radius + myRadius;
+
+					auto const a = glm::length2(displacement);
+					auto const b = glm::dot(relative, displacement);
+					auto const c = glm::length2(relative) - distance * distance;
+
+					if (c <= 0)
+					{
+						if (glm::length2(relative) > 0)
+							return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ 0, glm::normalize(relative) };
+
+						vector_type normal { 0 };
+						normal[0] = 1.0;
+
+						return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ 0, normal };
+					}
+
+					auto const discriminant = b * b - a * c;
+
+					if (a == 0 || b >= 0 || discriminant < 0)
+						return std::nullopt;
+
+					auto const fraction = (-b - glm::sqrt(discriminant)) / a;
+
+					if (fraction > 1)
+						return std::nullopt;
+
+					return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ fraction, glm::normalize(relative + fraction * displacement) };
+				}
+
 				_NODISCARD std::unordered_set <vector_type>
 				get_axes() const final {
 					return {};
 				}
 
-				_NODISCARD std::pair <double, double>
+				_NODISCARD std::pair <_ScalarTy, _ScalarTy>
 				get_projection (vector_type const& axis) const noexcept final
 				{
 					auto const projCenter = glm::dot(this->get_world_position(), axis);
@@ -301,9 +584,19 @@ namespace Coli
 					};
 				}
 
+				_NODISCARD vector_type get_support (vector_type const& direction) const noexcept final
+				{
+					auto const length = glm::length(direction);
+
+					if (length == 0)
+						return this->get_world_position();
+
+					return this->get_world_position() + direction * (myRadius / length);
+				}
+
 				friend struct nlohmann::adl_serializer <BasicRoundCollider>;
 
-				double myRadius;
+				_ScalarTy myRadius;
 			};
 
 			using BoxCollider   = BasicBoxCollider <false>;
@@ -311,14 +604,20 @@ namespace Coli
 
 			using SphereCollider   = BasicRoundCollider <false>;
 			using CircleCollider2D = BasicRoundCollider <true>;
+
+			using BoxColliderF   = BasicBoxCollider <false, float>;
+			using BoxCollider2DF = BasicBoxCollider <true,  float>;
+
+			using SphereColliderF   = BasicRoundCollider <false, float>;
+			using CircleCollider2DF = BasicRoundCollider <true,  float>;
 		}
 	}
 }
 
 namespace nlohmann
 {
-	template <bool _Use2D>
-	struct adl_serializer <Coli::Geometry::BasicBoxCollider<_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct adl_serializer <Coli::Geometry::BasicBoxCollider<_Use2D, _ScalarTy>>
 	{
 	private:
 		struct Keys {
@@ -326,18 +625,24 @@ namespace nlohmann
 			static constexpr std::string_view rotation		  = "rotation";
 			static constexpr std::string_view ignore_rotation = "ignoreRotation";
 			static constexpr std::string_view diagonal		  = "diagonal";
+			static constexpr std::string_view category		  = "category";
+			static constexpr std::string_view mask			  = "mask";
+			static constexpr std::string_view trigger		  = "trigger";
 		};
 
 	public:
-		static void to_json(json& j, Coli::Geometry::BasicBoxCollider <_Use2D> const& val)
+		static void to_json(json& j, Coli::Geometry::BasicBoxCollider <_Use2D, _ScalarTy> const& val)
 		{
 			j [Keys::half_sizes]	  = val.myHalfSizes;
 			j [Keys::rotation]		  = val.myRotation;
 			j [Keys::ignore_rotation] = val.myIgnoreRotationFlag;
 			j [Keys::diagonal]		  = val.myDiagonal;
+			j [Keys::category]		  = val.get_collision_category();
+			j [Keys::mask]			  = val.get_collision_mask();
+			j [Keys::trigger]		  = val.is_trigger();
 		}
 
-		static void from_json(const json& j, Coli::Geometry::BasicBoxCollider <_Use2D>& val)
+		static void from_json(const json& j, Coli::Geometry::BasicBoxCollider <_Use2D, _ScalarTy>& val)
 		{
 			using Coli::Detail::Json::try_fill;
 
@@ -353,28 +658,92 @@ namespace nlohmann
 			decltype (val.myDiagonal) tempDiagonal;
 			try_fill (j, tempDiagonal, Keys::diagonal);
 
+			/* the colliders saved before the categories belong to all of them */
+			uint32_t tempCategory = Coli::Detail::ColliderBase <_Use2D, _ScalarTy>::all_categories;
+
+			if (j.contains(Keys::category))
+				try_fill (j, tempCategory, Keys::category);
+
+			/* the colliders saved before the masks collide with everything */
+			uint32_t tempMask = Coli::Detail::ColliderBase <_Use2D, _ScalarTy>::all_categories;
+
+			if (j.contains(Keys::mask))
+				try_fill (j, tempMask, Keys::mask);
+
+			/* the colliders saved before the triggers are solid */
+			bool tempTrigger = false;
+
+			if (j.contains(Keys::trigger))
+				try_fill (j, tempTrigger, Keys::trigger);
+
 			val.myHalfSizes			 = tempHalfSizes;
 			val.myRotation			 = tempRotation;
 			val.myIgnoreRotationFlag = tempIgnoreRotation;
 			val.myDiagonal			 = tempDiagonal;
+
+			val.set_collision_category (tempCategory);
+			val.set_collision_mask	   (tempMask);
+
+			if (tempTrigger)
+				val.enable_trigger();
+			else
+				val.disable_trigger();
 		}
 	};
 
-	template <bool _Use2D>
-	struct adl_serializer <Coli::Geometry::BasicRoundCollider<_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct adl_serializer <Coli::Geometry::BasicRoundCollider<_Use2D, _ScalarTy>>
 	{
 	private:
 		struct Keys {
-			static constexpr std::string_view radius = "radius";
+			static constexpr std::string_view radius   = "radius";
+			static constexpr std::string_view category = "category";
+			static constexpr std::string_view mask	   = "mask";
+			static constexpr std::string_view trigger  = "trigger";
 		};
 
 	public:
-		static void to_json(json& j, Coli::Geometry::BasicRoundCollider <_Use2D> const& val) {
-			j [Keys::radius] = val.myRadius;
+		static void to_json(json& j, Coli::Geometry::BasicRoundCollider <_Use2D, _ScalarTy> const& val) {
+			j [Keys::radius]   = val.myRadius;
+			j [Keys::category] = val.get_collision_category();
+			j [Keys::mask]	   = val.get_collision_mask();
+			j [Keys::trigger]  = val.is_trigger();
 		}
 
-		static void from_json(const json& j, Coli::Geometry::BasicRoundCollider <_Use2D>& val) {
-			Coli::Detail::Json::try_fill (j, val.myRadius, Keys::radius);
+		static void from_json(const json& j, Coli::Geometry::BasicRoundCollider <_Use2D, _ScalarTy>& val) 
+		{
+			using Coli::Detail::Json::try_fill;
+
+			decltype (val.myRadius) tempRadius;
+			try_fill (j, tempRadius, Keys::radius);
+
+			/* the colliders saved before the categories belong to all of them */
+			uint32_t tempCategory = Coli::Detail::ColliderBase <_Use2D, _ScalarTy>::all_categories;
+
+			if (j.contains(Keys::category))
+				try_fill (j, tempCategory, Keys::category);
+
+			/* the colliders saved before the masks collide with everything */
+			uint32_t tempMask = Coli::Detail::ColliderBase <_Use2D, _ScalarTy>::all_categories;
+
+			if (j.contains(Keys::mask))
+				try_fill (j, tempMask, Keys::mask);
+
+			/* the colliders saved before the triggers are solid */
+			bool tempTrigger = false;
+
+			if (j.contains(Keys::trigger))
+				try_fill (j, tempTrigger, Keys::trigger);
+
+			val.myRadius = tempRadius;
+
+			val.set_collision_category (tempCategory);
+			val.set_collision_mask	   (tempMask);
+
+			if (tempTrigger)
+				val.enable_trigger();
+			else
+				val.disable_trigger();
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		enum class ContactPhase {
+			enter,
+			stay,
+			exit
+		};
+
+		/* the keys are ordered so the same contact always produces the same pair */
+		struct ContactPair
+		{
+			_NODISCARD static constexpr ContactPair make (size_t first, size_t second, bool trigger = false) noexcept {
+				return first < second ? ContactPair{ first, second, trigger } : ContactPair{ second, first, trigger };
+			}
+
+			_NODISCARD constexpr auto operator<=>(ContactPair const&) const noexcept = default;
+
+			size_t first;
+			size_t second;
+			bool   trigger;
+		};
+
+		class ContactListener
+		{
+		protected:
+			ContactListener() noexcept = default;
+
+		public:
+			virtual ~ContactListener() noexcept = default;
+
+			ContactListener(ContactListener&&)		= delete;
+			ContactListener(ContactListener const&) = delete;
+
+			ContactListener& operator=(ContactListener&&)	   = delete;
+			ContactListener& operator=(ContactListener const&) = delete;
+
+			virtual void on_contact (ContactPhase phase, ContactPair const& pair) = 0;
+		};
+	}
+}
\ No newline at end of file
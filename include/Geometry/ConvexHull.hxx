@@ -0,0 +1,526 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Mesh.hxx"
+#include "GlmHelper.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* a convex hull built by the quickhull which answers the support queries by climbing
+		   the vertices graph from a precomputed extreme vertex, so the cost hardly depends on the hull size */
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicConvexHull
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using plane_type  = std::pair <vector_type, _ScalarTy>;
+
+			static constexpr size_t min_vertices = _Use2D ? 3 : 4;
+
+			static void x_degenerate_hull() {
+				throw std::invalid_argument("The points do not span a convex hull");
+			}
+
+			static void x_small_budget() {
+				throw std::invalid_argument("The vertices budget is too small for a convex hull");
+			}
+
+			struct Outside
+			{
+				void assign (uint32_t point, _ScalarTy distance)
+				{
+					points.push_back(point);
+
+					if (distance > farthestDistance) {
+						farthest		 = point;
+						farthestDistance = distance;
+					}
+				}
+
+				std::vector <uint32_t> points;
+
+				uint32_t  farthest		   = 0;
+				_ScalarTy farthestDistance = 0;
+			};
+
+			struct Face
+			{
+				std::array <uint32_t, 3> vertices;
+
+				vector_type normal;
+				_ScalarTy	offset;
+
+				Outside outside;
+				bool	removed = false;
+			};
+
+			_NODISCARD static _ScalarTy get_tolerance (std::span <vector_type const> points) noexcept
+			{
+				vector_type extents { 0 };
+
+				for (auto const& point : points)
+					extents = glm::max(extents, glm::abs(point));
+
+				_ScalarTy sum = 0;
+
+				for (glm::length_t i = 0; i < vector_type::length(); ++i)
+					sum += extents[i];
+
+				return 3 * std::numeric_limits <_ScalarTy>::epsilon() * sum;
+			}
+
+			_NODISCARD static std::vector <std::array <uint32_t, 2>>
+			build_polygon (std::span <vector_type const> points, size_t maxVertices)
+			{
+				auto const tolerance = get_tolerance(points);
+				auto const [left, right] = std::ranges::minmax_element(points, [] (vector_type const& first, vector_type const& second) {
+					return first.x < second.x || (first.x == second.x && first.y < second.y);
+				});
+
+				auto const outward = [&] (uint32_t from, uint32_t to) noexcept
+				{
+					auto const edge = points[to] - points[from];
+					return glm::normalize(vector_type{ edge.y, -edge.x });
+				};
+
+				/* the hull is kept in the counter clockwise order, every edge owns the points behind it */
+				std::vector <uint32_t> hull {
+					static_cast<uint32_t>(left  - points.begin()),
+					static_cast<uint32_t>(right - points.begin())
+				};
+
+				if (glm::length2(*right - *left) <= tolerance * tolerance)
+					x_degenerate_hull();
+
+				std::vector <Outside> outsides (2);
+
+				auto const distribute = [&] (std::span <uint32_t const> candidates, size_t edge)
+				{
+					auto const from	  = hull[edge];
+					auto const to	  = hull[(edge + 1) % hull.size()];
+					auto const normal = outward(from, to);
+
+					Outside outside;
+
+					for (auto point : candidates)
+						if (auto const distance = glm::dot(normal, points[point] - points[from]); distance > tolerance)
+							outside.assign(point, distance);
+
+					return outside;
+				};
+
+				std::vector <uint32_t> all (points.size());
+				std::iota(all.begin(), all.end(), 0u);
+
+				outsides[0] = distribute(all, 0);
+				outsides[1] = distribute(all, 1);
+
+				while (hull.size() < maxVertices)
+				{
+					auto const edge = static_cast<size_t>(std::ranges::max_element(outsides, {}, &Outside::farthestDistance) - outsides.begin());
+
+					if (outsides[edge].points.empty())
+						break;
+
+					auto const candidates = std::move(outsides[edge].points);
+					auto const eye		  = outsides[edge].farthest;
+
+					hull.insert(hull.begin() + edge + 1, eye);
+					outsides.insert(outsides.begin() + edge + 1, Outside{});
+
+					outsides[edge]	   = distribute(candidates, edge);
+					outsides[edge + 1] = distribute(candidates, edge + 1);
+				}
+
+				if (hull.size() < min_vertices)
+					x_degenerate_hull();
+
+				std::vector <std::array <uint32_t, 2>> edges;
+				edges.reserve(hull.size());
+
+				for (size_t i = 0; i < hull.size(); ++i)
+					edges.push_back({ hull[i], hull[(i + 1) % hull.size()] });
+
+				return edges;
+			}
+
+			_NODISCARD static std::vector <std::array <uint32_t, 3>>
+			build_polyhedron (std::span <vector_type const> points, size_t maxVertices)
+			{
+				auto const tolerance = get_tolerance(points);
+
+				std::vector <Face> faces;
+				std::unordered_map <uint64_t, uint32_t> edgeFaces;
+
+				auto const edge_key = [] (uint32_t from, uint32_t to) noexcept {
+					return (static_cast<uint64_t>(from) << 32) | to;
+				};
+
+				auto const distance = [&] (Face const& face, uint32_t point) noexcept {
+					return glm::dot(face.normal, points[point]) - face.offset;
+				};
+
+				auto const add_face = [&] (uint32_t a, uint32_t b, uint32_t c)
+				{
+					auto const index  = static_cast<uint32_t>(faces.size());
+					auto const normal = glm::cross(points[b] - points[a], points[c] - points[a]);
+
+					auto& face = faces.emplace_back();
+
+					face.vertices = { a, b, c };
+					face.normal	  = glm::length2(normal) > 0 ? glm::normalize(normal) : normal;
+					face.offset	  = glm::dot(face.normal, points[a]);
+
+					edgeFaces[edge_key(a, b)] = index;
+					edgeFaces[edge_key(b, c)] = index;
+					edgeFaces[edge_key(c, a)] = index;
+
+					return index;
+				};
+
+				auto const farthest_from = [&] (auto&& measure) noexcept
+				{
+					uint32_t  best		   = 0;
+					_ScalarTy bestDistance = std::numeric_limits <_ScalarTy>::lowest();
+
+					for (uint32_t i = 0; i < points.size(); ++i)
+						if (auto const value = measure(points[i]); value > bestDistance) {
+							best		 = i;
+							bestDistance = value;
+						}
+
+					return std::pair{ best, bestDistance };
+				};
+
+				/* the initial tetrahedron spans the farthest extreme points */
+				std::array <uint32_t, 4> base;
+
+				std::tie(base[0], std::ignore) = farthest_from([] (vector_type const& point) noexcept { return point.x; });
+				std::tie(base[1], std::ignore) = farthest_from([&] (vector_type const& point) noexcept {
+					return glm::length2(point - points[base[0]]);
+				});
+
+				auto const line = points[base[1]] - points[base[0]];
+
+				_ScalarTy spread;
+				std::tie(base[2], spread) = farthest_from([&] (vector_type const& point) noexcept {
+					return glm::length(glm::cross(point - points[base[0]], line));
+				});
+
+				if (glm::length(line) <= tolerance || spread <= tolerance * glm::length(line))
+					x_degenerate_hull();
+
+				auto const baseNormal = glm::normalize(glm::cross(line, points[base[2]] - points[base[0]]));
+
+				std::tie(base[3], spread) = farthest_from([&] (vector_type const& point) noexcept {
+					return glm::abs(glm::dot(point - points[base[0]], baseNormal));
+				});
+
+				if (spread <= tolerance)
+					x_degenerate_hull();
+
+				if (glm::dot(points[base[3]] - points[base[0]], baseNormal) > 0)
+					std::swap(base[1], base[2]);
+
+				add_face (base[0], base[1], base[2]);
+				add_face (base[0], base[3], base[1]);
+				add_face (base[1], base[3], base[2]);
+				add_face (base[2], base[3], base[0]);
+
+				auto const distribute = [&] (std::span <uint32_t const> candidates, std::span <uint32_t const> targets)
+				{
+					for (auto point : candidates)
+						for (auto target : targets)
+							if (auto const value = distance(faces[target], point); value > tolerance) {
+								faces[target].outside.assign(point, value);
+								break;
+							}
+				};
+
+				std::vector <uint32_t> all (points.size());
+				std::iota(all.begin(), all.end(), 0u);
+
+				std::array <uint32_t, 4> const initial { 0, 1, 2, 3 };
+				distribute(all, initial);
+
+				std::vector <uint32_t> visible;
+				std::vector <uint32_t> created;
+				std::vector <uint32_t> orphans;
+
+				std::vector <std::pair <uint32_t, uint32_t>> horizon;
+				std::unordered_map <uint32_t, bool>			 seen;
+
+				for (size_t count = base.size(); count < maxVertices; ++count)
+				{
+					/* the farthest point overall goes first, so the reduced hull keeps the most significant ones */
+					Face* source = nullptr;
+
+					for (auto& face : faces)
+						if (!face.removed && !face.outside.points.empty())
+							if (!source || face.outside.farthestDistance > source->outside.farthestDistance)
+								source = &face;
+
+					if (!source)
+						break;
+
+					auto const eye = source->outside.farthest;
+
+					visible.assign({ static_cast<uint32_t>(source - faces.data()) });
+					horizon.clear();
+					seen.clear();
+
+					seen[visible.front()] = true;
+
+					for (size_t i = 0; i < visible.size(); ++i)
+					{
+						auto const vertices = faces[visible[i]].vertices;
+
+						for (size_t k = 0; k < 3; ++k)
+						{
+							auto const from	= vertices[k];
+							auto const to	= vertices[(k + 1) % 3];
+
+							auto const neighbour = edgeFaces.at(edge_key(to, from));
+							auto const [iter, inserted] = seen.try_emplace(neighbour, false);
+
+							if (inserted && distance(faces[neighbour], eye) > tolerance) {
+								iter->second = true;
+								visible.push_back(neighbour);
+							}
+							else if (!iter->second)
+								horizon.emplace_back(from, to);
+						}
+					}
+
+					orphans.clear();
+
+					for (auto index : visible)
+					{
+						auto& face = faces[index];
+
+						for (auto point : face.outside.points)
+							if (point != eye)
+								orphans.push_back(point);
+
+						for (size_t k = 0; k < 3; ++k)
+							edgeFaces.erase(edge_key(face.vertices[k], face.vertices[(k + 1) % 3]));
+
+						face.outside = {};
+						face.removed = true;
+					}
+
+					created.clear();
+
+					for (auto const& [from, to] : horizon)
+						created.push_back(add_face(from, to, eye));
+
+					distribute(orphans, created);
+				}
+
+				std::vector <std::array <uint32_t, 3>> triangles;
+
+				for (auto const& face : faces)
+					if (!face.removed)
+						triangles.push_back(face.vertices);
+
+				return triangles;
+			}
+
+			/* compacts the used points and derives the planes, the adjacency and the seeds */
+			template <size_t _Size>
+			void assemble (std::span <vector_type const> points, std::vector <std::array <uint32_t, _Size>> const& elements)
+			{
+				std::unordered_map <uint32_t, uint32_t> remap;
+
+				for (auto const& element : elements)
+					for (auto point : element)
+						if (remap.try_emplace(point, static_cast<uint32_t>(myVertices.size())).second)
+							myVertices.push_back(points[point]);
+
+				std::vector <std::vector <uint32_t>> adjacency (myVertices.size());
+
+				for (auto const& element : elements)
+				{
+					for (size_t k = 0; k < _Size; ++k)
+					{
+						auto const from = remap[element[k]];
+						auto const to	= remap[element[(k + 1) % _Size]];
+
+						adjacency[from].push_back(to);
+						adjacency[to].push_back(from);
+					}
+
+					auto const origin = myVertices[remap[element[0]]];
+					vector_type normal;
+
+					if constexpr (_Use2D) {
+						auto const edge = myVertices[remap[element[1]]] - origin;
+						normal = vector_type{ edge.y, -edge.x };
+					}
+					else
+						normal = glm::cross(myVertices[remap[element[1]]] - origin, myVertices[remap[element[2]]] - origin);
+
+					if (glm::length2(normal) > 0) {
+						normal = glm::normalize(normal);
+						myPlanes.emplace_back(normal, glm::dot(normal, origin));
+					}
+				}
+
+				myOffsets.reserve(adjacency.size() + 1);
+				myOffsets.push_back(0);
+
+				for (auto& neighbours : adjacency)
+				{
+					std::ranges::sort(neighbours);
+					auto const last = std::ranges::unique(neighbours).begin();
+
+					myNeighbours.insert(myNeighbours.end(), neighbours.begin(), last);
+					myOffsets.push_back(static_cast<uint32_t>(myNeighbours.size()));
+				}
+
+				for (auto const& vertex : myVertices)
+					myRadius = std::max(myRadius, glm::length(vertex));
+
+				/* the extreme vertices along a fixed set of directions to start the climbing from */
+				for (int x = -1; x <= 1; ++x)
+				for (int y = -1; y <= 1; ++y)
+				for (int z = _Use2D ? 0 : -1; z <= (_Use2D ? 0 : 1); ++z)
+				{
+					vector_type direction;
+
+					direction[0] = static_cast<_ScalarTy>(x);
+					direction[1] = static_cast<_ScalarTy>(y);
+
+					if constexpr (!_Use2D)
+						direction[2] = static_cast<_ScalarTy>(z);
+
+					if (glm::length2(direction) == 0)
+						continue;
+
+					direction = glm::normalize(direction);
+
+					auto const extreme = std::ranges::max_element(myVertices, {}, [&] (vector_type const& vertex) {
+						return glm::dot(vertex, direction);
+					});
+
+					mySeeds.emplace_back(direction, static_cast<uint32_t>(extreme - myVertices.begin()));
+				}
+			}
+
+		public:
+			static constexpr size_t default_max_vertices = 64;
+
+			BasicConvexHull() noexcept = default;
+
+			/* only the most distant points are kept when the hull would exceed the vertices budget */
+			explicit BasicConvexHull (std::span <vector_type const> points, size_t maxVertices = default_max_vertices)
+			{
+				if (maxVertices < min_vertices)
+					x_small_budget();
+
+				if (points.size() < min_vertices)
+					x_degenerate_hull();
+
+				if constexpr (_Use2D)
+					assemble(points, build_polygon(points, maxVertices));
+				else
+					assemble(points, build_polyhedron(points, maxVertices));
+			}
+
+			template <Detail::Vertex _VertexTy>
+			requires (Detail::VertexTraits <_VertexTy>::is_2D() == _Use2D)
+			explicit BasicConvexHull (Mesh <_VertexTy> const& mesh, size_t maxVertices = default_max_vertices) :
+				BasicConvexHull (convert(mesh.get_vertices()), maxVertices)
+			{}
+
+			BasicConvexHull(BasicConvexHull&&)		= default;
+			BasicConvexHull(BasicConvexHull const&) = default;
+
+			BasicConvexHull& operator=(BasicConvexHull&&)	   = default;
+			BasicConvexHull& operator=(BasicConvexHull const&) = default;
+
+			/* the farthest vertex along the direction */
+			_NODISCARD vector_type get_support (vector_type const& direction) const noexcept
+			{
+				if (mySeeds.empty())
+					return vector_type{ 0 };
+
+				auto const seed = std::ranges::max_element(mySeeds, {}, [&] (auto const& seed) {
+					return glm::dot(seed.first, direction);
+				});
+
+				auto current = seed->second;
+				auto best	 = glm::dot(myVertices[current], direction);
+
+				for (bool climbed = true; climbed; )
+				{
+					climbed = false;
+
+					for (auto i = myOffsets[current]; i < myOffsets[current + 1]; ++i)
+					{
+						auto const neighbour = myNeighbours[i];
+						auto const value	 = glm::dot(myVertices[neighbour], direction);
+
+						if (value > best) {
+							best	= value;
+							current = neighbour;
+							climbed = true;
+							break;
+						}
+					}
+				}
+
+				return myVertices[current];
+			}
+
+			_NODISCARD std::span <vector_type const> get_vertices() const noexcept {
+				return myVertices;
+			}
+
+			/* outward normals with the distances from the origin, edges in 2D and triangles in 3D */
+			_NODISCARD std::span <plane_type const> get_planes() const noexcept {
+				return myPlanes;
+			}
+
+			_NODISCARD _ScalarTy get_radius() const noexcept {
+				return myRadius;
+			}
+
+			_NODISCARD bool empty() const noexcept {
+				return myVertices.empty();
+			}
+
+		private:
+			template <class _VertexTy>
+			_NODISCARD static std::vector <vector_type> convert (std::span <_VertexTy const> vertices)
+			{
+				std::vector <vector_type> points;
+				points.reserve(vertices.size());
+
+				for (auto const& vertex : vertices)
+					points.emplace_back(vertex.position);
+
+				return points;
+			}
+
+			std::vector <vector_type> myVertices;
+			std::vector <plane_type>  myPlanes;
+
+			std::vector <uint32_t> myOffsets;
+			std::vector <uint32_t> myNeighbours;
+
+			std::vector <std::pair <vector_type, uint32_t>> mySeeds;
+
+			_ScalarTy myRadius = 0;
+		};
+
+		using ConvexHull   = BasicConvexHull <false>;
+		using ConvexHull2D = BasicConvexHull <true>;
+
+		using ConvexHullF	= BasicConvexHull <false, float>;
+		using ConvexHull2DF = BasicConvexHull <true,  float>;
+	}
+}
\ No newline at end of file
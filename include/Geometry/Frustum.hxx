@@ -0,0 +1,134 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Bounds.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* the six planes of the clip space taken back to the world, all of them face inwards,
+		   the default frustum has only the degenerate planes and keeps everything */
+		class Frustum final
+		{
+		public:
+			/* the spheres tested by one instruction */
+			static constexpr size_t batch_size = 4;
+
+			Frustum() noexcept = default;
+
+			explicit Frustum (glm::mat4 const& viewProjection) noexcept
+			{
+				auto const row = [&viewProjection] (glm::length_t i) noexcept {
+					return glm::vec4{ viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i] };
+				};
+
+				myPlanes = {
+					row(3) + row(0), row(3) - row(0),
+					row(3) + row(1), row(3) - row(1),
+					row(3) + row(2), row(3) - row(2)
+				};
+
+				/* the infinite depth range of the 2D cameras leaves the near and far planes without the normal */
+				for (auto& plane : myPlanes)
+					if (auto const length = glm::length(glm::vec3(plane)); length > 0.f)
+						plane /= length;
+			}
+
+			_NODISCARD bool intersects (glm::vec3 const& center, float radius) const noexcept
+			{
+				for (auto const& plane : myPlanes)
+					if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+						return false;
+
+				return true;
+			}
+
+			_NODISCARD bool intersects (BoundsF const& bounds) const noexcept {
+				return classify(bounds) != Containment::outside;
+			}
+
+			/* the bounds laying in front of all the planes by their nearest corner are inside */
+			_NODISCARD Containment classify (BoundsF const& bounds) const noexcept
+			{
+				auto result = Containment::inside;
+
+				for (auto const& plane : myPlanes)
+				{
+					auto const normal = glm::vec3(plane);
+
+					auto furthest = bounds.min;
+					auto nearest  = bounds.max;
+
+					for (glm::length_t i = 0; i < 3; ++i)
+						if (normal[i] >= 0.f)
+							std::swap(furthest[i], nearest[i]);
+
+					if (glm::dot(normal, furthest) + plane.w < 0.f)
+						return Containment::outside;
+
+					if (glm::dot(normal, nearest) + plane.w < 0.f)
+						result = Containment::intersects;
+				}
+
+				return result;
+			}
+
+			/* the spheres keep the center in xyz and the radius in w, returns how many of them are visible */
+			size_t cull (std::span <glm::vec4 const> spheres, std::span <uint8_t> visibility) const noexcept
+			{
+				size_t visible = 0;
+				size_t i	   = 0;
+
+#ifdef COLI_SSE
+				for (; i + batch_size <= spheres.size(); i += batch_size)
+				{
+					auto x = _mm_loadu_ps(glm::value_ptr(spheres[i]));
+					auto y = _mm_loadu_ps(glm::value_ptr(spheres[i + 1]));
+					auto z = _mm_loadu_ps(glm::value_ptr(spheres[i + 2]));
+					auto r = _mm_loadu_ps(glm::value_ptr(spheres[i + 3]));
+
+					_MM_TRANSPOSE4_PS(x, y, z, r);
+
+					auto const negative = _mm_sub_ps(_mm_setzero_ps(), r);
+					auto outside		= _mm_setzero_ps();
+
+					for (auto const& plane : myPlanes)
+					{
+						auto const distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)),
+																	_mm_mul_ps(y, _mm_set1_ps(plane.y))),
+														 _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.z)),
+																	_mm_set1_ps(plane.w)));
+
+						outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negative));
+					}
+
+					auto const mask = _mm_movemask_ps(outside);
+
+					for (size_t lane = 0; lane < batch_size; ++lane) {
+						visibility[i + lane] = !(mask & (1 << lane));
+						visible				+= visibility[i + lane];
+					}
+				}
+#endif
+
+				for (; i < spheres.size(); ++i) {
+					visibility[i] = intersects(glm::vec3(spheres[i]), spheres[i].w);
+					visible		 += visibility[i];
+				}
+
+				return visible;
+			}
+
+		private:
+			std::array <glm::vec4, 6> myPlanes = [] () noexcept {
+				std::array <glm::vec4, 6> planes;
+				planes.fill(glm::vec4{ 0.f, 0.f, 0.f, 1.f });
+
+				return planes;
+			}();
+		};
+	}
+}
\ No newline at end of file
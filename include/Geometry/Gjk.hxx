@@ -0,0 +1,365 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		namespace GJK
+		{
+			inline constexpr size_t max_iterations	   = 64;
+			inline constexpr size_t max_epa_iterations = 64;
+
+			/* the newest point is always the first one */
+			template <class _VectorTy>
+			class Simplex final
+			{
+			public:
+				static constexpr size_t capacity = _VectorTy::length() + 1;
+
+				Simplex() noexcept = default;
+
+				Simplex (std::initializer_list <_VectorTy> points) noexcept {
+					assign(points);
+				}
+
+				void assign (std::initializer_list <_VectorTy> points) noexcept
+				{
+					mySize = std::min(points.size(), capacity);
+					std::copy_n(points.begin(), mySize, myPoints.begin());
+				}
+
+				void push_front (_VectorTy const& point) noexcept
+				{
+					for (auto i = std::min(mySize, capacity - 1); i > 0; --i)
+						myPoints[i] = myPoints[i - 1];
+
+					myPoints[0] = point;
+					mySize = std::min(mySize + 1, capacity);
+				}
+
+				_NODISCARD _VectorTy const& operator[](size_t index) const noexcept {
+					return myPoints[index];
+				}
+
+				_NODISCARD size_t size() const noexcept {
+					return mySize;
+				}
+
+			private:
+				std::array <_VectorTy, capacity> myPoints;
+				size_t mySize = 0;
+			};
+
+			/* a direction perpendicular to the edge which looks at the target */
+			template <class _VectorTy>
+			_NODISCARD _VectorTy perpendicular (_VectorTy const& edge, _VectorTy const& target) noexcept
+			{
+				if constexpr (_VectorTy::length() == 2)
+				{
+					_VectorTy const normal { -edge.y, edge.x };
+					return glm::dot(normal, target) < 0 ? -normal : normal;
+				}
+				else
+				{
+					auto const normal = glm::cross(glm::cross(edge, target), edge);
+
+					if (glm::length2(normal) > 0)
+						return normal;
+
+					/* the target lays on the edge line, any perpendicular direction fits */
+					auto const axis = glm::abs(edge.x) < glm::abs(edge.y) ? _VectorTy{ 1, 0, 0 } : _VectorTy{ 0, 1, 0 };
+					return glm::cross(edge, axis);
+				}
+			}
+
+			template <class _VectorTy>
+			void update_line (Simplex <_VectorTy>& simplex, _VectorTy& direction) noexcept
+			{
+				auto const a = simplex[0];
+				auto const b = simplex[1];
+
+				if (glm::dot(b - a, -a) > 0)
+					direction = perpendicular(b - a, -a);
+				else {
+					simplex.assign({ a });
+					direction = -a;
+				}
+			}
+
+			template <class _VectorTy>
+			_NODISCARD bool update_triangle (Simplex <_VectorTy>& simplex, _VectorTy& direction) noexcept
+			{
+				auto const a = simplex[0];
+				auto const b = simplex[1];
+				auto const c = simplex[2];
+
+				auto const ab = b - a;
+				auto const ac = c - a;
+				auto const ao = -a;
+
+				if constexpr (_VectorTy::length() == 2)
+				{
+					auto const abNormal = -perpendicular(ab, ac);
+					auto const acNormal = -perpendicular(ac, ab);
+
+					if (glm::dot(abNormal, ao) > 0) {
+						simplex.assign({ a, b });
+						direction = abNormal;
+					}
+					else if (glm::dot(acNormal, ao) > 0) {
+						simplex.assign({ a, c });
+						direction = acNormal;
+					}
+					else
+						return true;
+				}
+				else
+				{
+					auto const normal = glm::cross(ab, ac);
+
+					if (glm::length2(normal) == 0) {
+						simplex.assign({ a, b });
+						update_line(simplex, direction);
+					}
+					else if (glm::dot(glm::cross(normal, ac), ao) > 0) {
+						simplex.assign({ a, c });
+						direction = perpendicular(ac, ao);
+					}
+					else if (glm::dot(glm::cross(ab, normal), ao) > 0) {
+						simplex.assign({ a, b });
+						direction = perpendicular(ab, ao);
+					}
+					else if (glm::dot(normal, ao) > 0)
+						direction = normal;
+
+					else {
+						simplex.assign({ a, c, b });
+						direction = -normal;
+					}
+				}
+
+				return false;
+			}
+
+			template <class _VectorTy>
+			_NODISCARD bool update_tetrahedron (Simplex <_VectorTy>& simplex, _VectorTy& direction) noexcept
+			{
+				auto const a = simplex[0];
+				auto const b = simplex[1];
+				auto const c = simplex[2];
+				auto const d = simplex[3];
+
+				auto const ao = -a;
+
+				if (glm::dot(glm::cross(b - a, c - a), ao) > 0) {
+					simplex.assign({ a, b, c });
+					return update_triangle(simplex, direction);
+				}
+
+				if (glm::dot(glm::cross(c - a, d - a), ao) > 0) {
+					simplex.assign({ a, c, d });
+					return update_triangle(simplex, direction);
+				}
+
+				if (glm::dot(glm::cross(d - a, b - a), ao) > 0) {
+					simplex.assign({ a, d, b });
+					return update_triangle(simplex, direction);
+				}
+
+				return true;
+			}
+
+			/* searches the minkowski difference given by its support mapping for the origin,
+			   returns the simplex enclosing it or nothing when the shapes are separated or only touch */
+			template <class _VectorTy, std::invocable <_VectorTy const&> _SupportTy>
+			_NODISCARD std::optional <Simplex <_VectorTy>> find_simplex (_SupportTy&& support, _VectorTy direction)
+			{
+				if (glm::length2(direction) == 0)
+					direction[0] = 1;
+
+				Simplex <_VectorTy> simplex { support(direction) };
+				direction = -simplex[0];
+
+				for (size_t i = 0; i < max_iterations; ++i)
+				{
+					if (glm::length2(direction) == 0)
+						return std::nullopt;
+
+					auto const point = support(direction);
+
+					if (glm::dot(point, direction) <= 0)
+						return std::nullopt;
+
+					simplex.push_front(point);
+
+					bool enclosed = false;
+
+					switch (simplex.size())
+					{
+						case 2: update_line (simplex, direction); break;
+						case 3: enclosed = update_triangle (simplex, direction); break;
+						case 4:
+							if constexpr (_VectorTy::length() == 3)
+								enclosed = update_tetrahedron (simplex, direction);
+							break;
+					}
+
+					if (enclosed)
+						return simplex;
+				}
+
+				return std::nullopt;
+			}
+
+			/* expands the enclosing simplex towards the boundary of the minkowski difference,
+			   returns the penetration normal and depth */
+			template <class _VectorTy, std::invocable <_VectorTy const&> _SupportTy>
+			_NODISCARD std::pair <_VectorTy, typename _VectorTy::value_type>
+			find_penetration (_SupportTy&& support, Simplex <_VectorTy> const& simplex)
+			{
+				using scalar_type = typename _VectorTy::value_type;
+
+				auto const tolerance = glm::sqrt(std::numeric_limits <scalar_type>::epsilon());
+
+				std::pair <_VectorTy, scalar_type> best { _VectorTy{ 0 }, 0 };
+
+				if constexpr (_VectorTy::length() == 2)
+				{
+					std::vector <_VectorTy> polygon { simplex[0], simplex[1], simplex[2] };
+
+					auto const ab = polygon[1] - polygon[0];
+					auto const ac = polygon[2] - polygon[0];
+
+					if (ab.x * ac.y - ab.y * ac.x < 0)
+						std::swap(polygon[1], polygon[2]);
+
+					for (size_t i = 0; i < max_epa_iterations; ++i)
+					{
+						size_t	  closest  = 0;
+						_VectorTy normal   { 0 };
+						auto	  distance = std::numeric_limits <scalar_type>::max();
+
+						for (size_t j = 0; j < polygon.size(); ++j)
+						{
+							auto const edge = polygon[(j + 1) % polygon.size()] - polygon[j];
+
+							if (glm::length2(edge) == 0)
+								continue;
+
+							auto const edgeNormal	= glm::normalize(_VectorTy{ edge.y, -edge.x });
+							auto const edgeDistance = glm::dot(edgeNormal, polygon[j]);
+
+							if (edgeDistance < distance) {
+								closest  = j;
+								normal	 = edgeNormal;
+								distance = edgeDistance;
+							}
+						}
+
+						best = { normal, distance };
+
+						auto const point = support(normal);
+
+						if (glm::dot(point, normal) - distance <= tolerance * (1 + distance))
+							break;
+
+						polygon.insert(polygon.begin() + closest + 1, point);
+					}
+				}
+				else
+				{
+					struct Face
+					{
+						std::array <size_t, 3> vertices;
+
+						_VectorTy	normal;
+						scalar_type distance;
+					};
+
+					std::vector <_VectorTy> vertices { simplex[0], simplex[1], simplex[2], simplex[3] };
+					std::vector <Face>		faces;
+
+					std::vector <std::pair <size_t, size_t>> edges;
+
+					auto const make_face = [&] (size_t a, size_t b, size_t c) noexcept
+					{
+						auto const normal = glm::cross(vertices[b] - vertices[a], vertices[c] - vertices[a]);
+
+						/* degenerated faces are never chosen nor seen */
+						if (glm::length2(normal) == 0)
+							return Face{ { a, b, c }, _VectorTy{ 0 }, std::numeric_limits <scalar_type>::max() };
+
+						auto const unit = glm::normalize(normal);
+						return Face{ { a, b, c }, unit, glm::dot(unit, vertices[a]) };
+					};
+
+					/* every face of the tetrahedron has to look away from its opposite vertex */
+					for (auto const [a, b, c, opposite] : std::array { std::array <size_t, 4>{ 0, 1, 2, 3 },
+																	   std::array <size_t, 4>{ 0, 3, 1, 2 },
+																	   std::array <size_t, 4>{ 0, 2, 3, 1 },
+																	   std::array <size_t, 4>{ 1, 3, 2, 0 } })
+					{
+						auto const normal = glm::cross(vertices[b] - vertices[a], vertices[c] - vertices[a]);
+
+						if (glm::dot(normal, vertices[opposite] - vertices[a]) > 0)
+							faces.push_back(make_face(a, c, b));
+						else
+							faces.push_back(make_face(a, b, c));
+					}
+
+					for (size_t i = 0; i < max_epa_iterations; ++i)
+					{
+						auto const closest = std::ranges::min_element(faces, {}, &Face::distance);
+
+						if (closest == faces.end())
+							break;
+
+						best = { closest->normal, closest->distance };
+
+						auto const point = support(closest->normal);
+
+						if (glm::dot(point, closest->normal) - closest->distance <= tolerance * (1 + closest->distance))
+							break;
+
+						edges.clear();
+
+						for (size_t j = faces.size(); j-- > 0; )
+						{
+							auto const& face = faces[j];
+
+							if (glm::dot(face.normal, point - vertices[face.vertices[0]]) <= 0)
+								continue;
+
+							/* the edges shared by two removed faces are inside, the others form the horizon */
+							for (size_t k = 0; k < 3; ++k)
+							{
+								std::pair const edge { face.vertices[k], face.vertices[(k + 1) % 3] };
+
+								auto const reversed = std::ranges::find(edges, std::pair{ edge.second, edge.first });
+
+								if (reversed != edges.end())
+									edges.erase(reversed);
+								else
+									edges.push_back(edge);
+							}
+
+							faces[j] = faces.back();
+							faces.pop_back();
+						}
+
+						auto const index = vertices.size();
+						vertices.push_back(point);
+
+						for (auto const& [a, b] : edges)
+							faces.push_back(make_face(a, b, index));
+					}
+				}
+
+				return best;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -15,6 +15,51 @@ namespace Coli
 
 		template <>
 		inline constexpr glm::dquat default_rotator <glm::dquat> = glm::dquat::wxyz(1.0, 0.0, 0.0, 0.0);
+
+		template <>
+		inline constexpr float default_rotator <float> = 0;
+
+		template <>
+		inline constexpr glm::quat default_rotator <glm::quat> = glm::quat::wxyz(1.f, 0.f, 0.f, 0.f);
+
+		template <bool _Use2D, std::floating_point _ScalarTy>
+		using rotator_t = std::conditional_t <_Use2D, _ScalarTy, glm::qua <_ScalarTy>>;
+
+		/* 2D rotators are angles in degrees, 3D ones are quaternions */
+		template <class _T, glm::qualifier _Q, class _RotatorTy>
+		_NODISCARD glm::vec <2, _T, _Q> rotate_vector (_RotatorTy const& rotator, glm::vec <2, _T, _Q> const& vec) noexcept
+		{
+			auto const angle = glm::radians(static_cast<_T>(rotator));
+
+			return { glm::cos(angle) * vec.x - glm::sin(angle) * vec.y,
+					 glm::sin(angle) * vec.x + glm::cos(angle) * vec.y };
+		}
+
+		template <class _T, glm::qualifier _Q>
+		_NODISCARD glm::vec <3, _T, _Q> rotate_vector (glm::qua <_T, _Q> const& rotator, glm::vec <3, _T, _Q> const& vec) noexcept {
+			return glm::rotate (rotator, vec);
+		}
+
+		template <class _T, glm::qualifier _Q, class _RotatorTy>
+		_NODISCARD glm::vec <2, _T, _Q> unrotate_vector (_RotatorTy const& rotator, glm::vec <2, _T, _Q> const& vec) noexcept {
+			return rotate_vector (-rotator, vec);
+		}
+
+		template <class _T, glm::qualifier _Q>
+		_NODISCARD glm::vec <3, _T, _Q> unrotate_vector (glm::qua <_T, _Q> const& rotator, glm::vec <3, _T, _Q> const& vec) noexcept {
+			return glm::rotate (glm::inverse(rotator), vec);
+		}
+
+		template <glm::length_t _L, class _T, glm::qualifier _Q>
+		_NODISCARD constexpr _T max_component (glm::vec <_L, _T, _Q> const& val) noexcept
+		{
+			auto result = val[0];
+
+			for (glm::length_t i = 1; i < _L; ++i)
+				result = std::max(result, val[i]);
+
+			return result;
+		}
 	}
 }
 
@@ -0,0 +1,261 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Collider.hxx"
+#include "ConvexHull.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		inline namespace GJK
+		{
+			/* a single collider for an arbitrary convex shape, the pairs with it are solved by the GJK and EPA */
+			template <bool _Use2D, std::floating_point _ScalarTy = double>
+			class BasicHullCollider :
+				public Detail::SAT::ColliderBase <_Use2D, _ScalarTy>
+			{
+				using vector_type  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+				using rotator_type = Detail::rotator_t <_Use2D, _ScalarTy>;
+				using hull_type	   = BasicConvexHull <_Use2D, _ScalarTy>;
+
+			public:
+				BasicHullCollider() noexcept = default;
+
+				explicit BasicHullCollider (
+					hull_type hull,
+					rotator_type const& rotator = Detail::default_rotator <rotator_type>
+				) noexcept :
+					myHull	   (std::move(hull)),
+					myRotation (rotator)
+				{}
+
+				template <Detail::Vertex _VertexTy>
+				explicit BasicHullCollider (
+					Mesh <_VertexTy> const& mesh,
+					size_t maxVertices = hull_type::default_max_vertices
+				) :
+					myHull (mesh, maxVertices)
+				{}
+
+				BasicHullCollider(BasicHullCollider&&)		= default;
+				BasicHullCollider(BasicHullCollider const&) = default;
+
+				BasicHullCollider& operator=(BasicHullCollider&&)	   = default;
+				BasicHullCollider& operator=(BasicHullCollider const&) = default;
+
+				void disable_transform_rotation() noexcept {
+					myIgnoreRotationFlag = true;
+				}
+
+				void enable_transform_rotation() noexcept {
+					myIgnoreRotationFlag = false;
+				}
+
+				_NODISCARD hull_type const& get_hull() const noexcept {
+					return myHull;
+				}
+
+			private:
+				_NODISCARD rotator_type get_rotator() const noexcept
+				{
+					if (myIgnoreRotationFlag)
+						return myRotation;
+
+					else if (auto transform = myTransform.lock()) {
+						if constexpr (_Use2D)
+							return myRotation + transform->get_world_rotation();
+						else
+							return myRotation * transform->get_world_rotation();
+					}
+					else
+						return myRotation;
+				}
+
+				_NODISCARD vector_type get_scale() const noexcept
+				{
+					if (auto transform = myTransform.lock())
+						return transform->get_world_scale();
+
+					return vector_type{ 1 };
+				}
+
+				_NODISCARD bool has_axes() const noexcept final {
+					return false;
+				}
+
+				_NODISCARD _ScalarTy get_longest_diagonal() const noexcept final {
+					return myHull.get_radius();
+				}
+
+				_NODISCARD std::unordered_set <vector_type>
+				get_axes() const final {
+					return {};
+				}
+
+				_NODISCARD std::pair <_ScalarTy, _ScalarTy>
+				get_projection (vector_type const& axis) const noexcept final {
+					return { glm::dot(get_support(-axis), axis), glm::dot(get_support(axis), axis) };
+				}
+
+				/* the support of a scaled hull is the scaled support along the scaled direction */
+				_NODISCARD vector_type get_support (vector_type const& direction) const noexcept final
+				{
+					auto const rotator = get_rotator();
+					auto const scale   = get_scale();
+					auto const local   = Detail::unrotate_vector(rotator, direction) * scale;
+
+					return this->get_world_position() + Detail::rotate_vector(rotator, myHull.get_support(local) * scale);
+				}
+
+				/* clips the path by the hull planes pushed out by the radius like the box does with its extents */
+				_NODISCARD std::optional <Geometry::BasicSweepHit <_Use2D, _ScalarTy>>
+				cast_sphere (
+					vector_type const& origin,
+					vector_type const& displacement,
+					_ScalarTy radius
+				) const noexcept final
+				{
+					if (myHull.empty())
+						return std::nullopt;
+
+					auto const rotator = get_rotator();
+					auto const scale   = get_scale();
+
+					auto const start = Detail::unrotate_vector(rotator, origin - this->get_world_position());
+					auto const delta = Detail::unrotate_vector(rotator, displacement);
+
+					_ScalarTy	enter = 0;
+					_ScalarTy	leave = 1;
+					vector_type normal { 0 };
+
+					for (auto const& [planeNormal, planeOffset] : myHull.get_planes())
+					{
+						auto const scaled = planeNormal / scale;
+						auto const length = glm::length(scaled);
+
+						auto const axis	  = scaled / length;
+						auto const offset = planeOffset / length + radius;
+
+						auto const distance = offset - glm::dot(axis, start);
+						auto const approach = glm::dot(axis, delta);
+
+						if (approach == 0) {
+							if (distance < 0)
+								return std::nullopt;
+
+							continue;
+						}
+
+						auto const fraction = distance / approach;
+
+						if (approach < 0) {
+							if (fraction > enter) {
+								enter  = fraction;
+								normal = axis;
+							}
+						}
+						else
+							leave = std::min(leave, fraction);
+
+						if (enter > leave)
+							return std::nullopt;
+					}
+
+					if (glm::length2(normal) > 0)
+						return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ enter, Detail::rotate_vector(rotator, normal) };
+
+					else if (glm::length2(displacement) > 0)
+						return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ 0, -glm::normalize(displacement) };
+
+					normal[0] = 1;
+					return Geometry::BasicSweepHit<_Use2D, _ScalarTy>{ 0, normal };
+				}
+
+				friend struct nlohmann::adl_serializer <BasicHullCollider>;
+
+				using Detail::SAT::ColliderBase <_Use2D, _ScalarTy>::myTransform;
+
+				hull_type	 myHull;
+				rotator_type myRotation			  = Detail::default_rotator <rotator_type>;
+				bool		 myIgnoreRotationFlag = false;
+			};
+
+			using HullCollider	 = BasicHullCollider <false>;
+			using HullCollider2D = BasicHullCollider <true>;
+
+			using HullColliderF	  = BasicHullCollider <false, float>;
+			using HullCollider2DF = BasicHullCollider <true,  float>;
+		}
+	}
+}
+
+namespace nlohmann
+{
+	template <bool _Use2D, class _ScalarTy>
+	struct adl_serializer <Coli::Geometry::BasicHullCollider<_Use2D, _ScalarTy>>
+	{
+	private:
+		using hull_type = Coli::Geometry::BasicConvexHull <_Use2D, _ScalarTy>;
+
+		struct Keys {
+			static constexpr std::string_view vertices		  = "vertices";
+			static constexpr std::string_view rotation		  = "rotation";
+			static constexpr std::string_view ignore_rotation = "ignoreRotation";
+			static constexpr std::string_view category		  = "category";
+			static constexpr std::string_view mask			  = "mask";
+			static constexpr std::string_view trigger		  = "trigger";
+		};
+
+	public:
+		static void to_json(json& j, Coli::Geometry::BasicHullCollider <_Use2D, _ScalarTy> const& val)
+		{
+			auto const vertices = val.myHull.get_vertices();
+
+			j [Keys::vertices]		  = std::vector(vertices.begin(), vertices.end());
+			j [Keys::rotation]		  = val.myRotation;
+			j [Keys::ignore_rotation] = val.myIgnoreRotationFlag;
+			j [Keys::category]		  = val.get_collision_category();
+			j [Keys::mask]			  = val.get_collision_mask();
+			j [Keys::trigger]		  = val.is_trigger();
+		}
+
+		/* the hull is rebuilt from its vertices, which keeps the saved objects small */
+		static void from_json(const json& j, Coli::Geometry::BasicHullCollider <_Use2D, _ScalarTy>& val)
+		{
+			using Coli::Detail::Json::try_fill;
+
+			std::vector <glm::vec <_Use2D ? 2 : 3, _ScalarTy>> tempVertices;
+			try_fill (j, tempVertices, Keys::vertices);
+
+			decltype (val.myRotation) tempRotation;
+			try_fill (j, tempRotation, Keys::rotation);
+
+			decltype (val.myIgnoreRotationFlag) tempIgnoreRotation;
+			try_fill (j, tempIgnoreRotation, Keys::ignore_rotation);
+
+			uint32_t tempCategory;
+			try_fill (j, tempCategory, Keys::category);
+
+			uint32_t tempMask;
+			try_fill (j, tempMask, Keys::mask);
+
+			bool tempTrigger;
+			try_fill (j, tempTrigger, Keys::trigger);
+
+			val.myHull				 = hull_type(tempVertices, std::max(tempVertices.size(), hull_type::default_max_vertices));
+			val.myRotation			 = tempRotation;
+			val.myIgnoreRotationFlag = tempIgnoreRotation;
+
+			val.set_collision_category (tempCategory);
+			val.set_collision_mask	   (tempMask);
+
+			if (tempTrigger)
+				val.enable_trigger();
+			else
+				val.disable_trigger();
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Mesh.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* the average cache miss ratio, the vertices transformed per triangle, before and after an optimization */
+		struct IndexStatistics
+		{
+			double acmrBefore = 0;
+			double acmrAfter  = 0;
+		};
+
+		/* reorders the triangles of a mesh for the post transform vertex cache by the tipsify algorithm,
+		   optionally sorts the clusters it leaves for less overdraw, then renumbers the vertices in the order
+		   of their first use so they are fetched sequentially, the triangles themselves are never changed */
+		template <Detail::Vertex _VertexTy>
+		class IndexOptimizer final
+		{
+			using mesh_type = Mesh <_VertexTy>;
+
+			static constexpr uint32_t null_vertex = std::numeric_limits <uint32_t>::max();
+
+		public:
+			struct Configuration {
+				/* the cache entries simulated, smaller than the real cache is safer than larger */
+				size_t cacheSize = 16;
+				/* the clusters facing outwards are drawn first, so they hide more of the later ones */
+				bool overdraw = false;
+				/* how much worse than the whole mesh a cluster may use the cache, the larger the smaller clusters */
+				double overdrawThreshold = 1.05;
+			};
+
+			explicit IndexOptimizer (Configuration const& config = {}) noexcept :
+				myConfig (config)
+			{}
+
+			_NODISCARD mesh_type operator()(mesh_type const& mesh) const
+			{
+				std::vector <size_t> clusters;
+				auto indices = reorder_triangles(mesh.get_indices(), mesh.get_vertices().size(), clusters);
+
+				if (myConfig.overdraw) {
+					clusters = split_clusters(indices, mesh.get_vertices().size(), clusters);
+					indices	 = reorder_clusters(mesh.get_vertices(), indices, clusters);
+				}
+
+				return reorder_vertices(mesh.get_vertices(), std::move(indices));
+			}
+
+			/* the optimized mesh along with its miss ratios, both simulated by the configured cache */
+			_NODISCARD mesh_type operator()(mesh_type const& mesh, IndexStatistics& statistics) const
+			{
+				statistics.acmrBefore = get_acmr(mesh.get_indices(), mesh.get_vertices().size(), myConfig.cacheSize);
+
+				auto result = (*this)(mesh);
+
+				statistics.acmrAfter = get_acmr(result.get_indices(), result.get_vertices().size(), myConfig.cacheSize);
+				return result;
+			}
+
+			/* the vertices missed by a first in first out cache of the size per triangle, between 0.5 and 3 */
+			_NODISCARD static double get_acmr (std::span <unsigned const> indices, size_t verticesCount, size_t cacheSize)
+			{
+				if (indices.size() < 3)
+					return 0.0;
+
+				/* a vertex stays in the cache until the later misses push it out */
+				std::vector <size_t> stamps (verticesCount);
+
+				auto   time	  = cacheSize + 1;
+				size_t misses = 0;
+
+				for (auto const index : indices)
+					if (time - stamps[index] > cacheSize) {
+						stamps[index] = time++;
+						++misses;
+					}
+
+				return static_cast <double>(misses) / static_cast <double>(indices.size() / 3);
+			}
+
+		private:
+			/* the triangles are emitted by fanning around a vertex, the next one is the vertex which stays
+			   in the cache after its remaining triangles are emitted, the restarts bound the clusters */
+			_NODISCARD std::vector <unsigned> reorder_triangles (
+				std::span <unsigned const> indices,
+				size_t verticesCount,
+				std::vector <size_t>& clusters
+			) const {
+				auto const trianglesCount = indices.size() / 3;
+				auto const cacheSize	  = myConfig.cacheSize;
+
+				std::vector <uint32_t> offsets (verticesCount + 1);
+
+				for (size_t i = 0; i < trianglesCount * 3; ++i)
+					++offsets[indices[i] + 1];
+
+				std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+				std::vector <uint32_t> live (offsets.begin() + 1, offsets.end());
+				std::adjacent_difference(live.begin(), live.end(), live.begin());
+
+				std::vector <uint32_t> adjacency (trianglesCount * 3);
+				std::vector <uint32_t> cursors	 (offsets.begin(), offsets.end() - 1);
+
+				for (size_t i = 0; i < trianglesCount * 3; ++i)
+					adjacency[cursors[indices[i]]++] = static_cast <uint32_t>(i / 3);
+
+				std::vector <size_t>   stamps	 (verticesCount);
+				std::vector <uint8_t>  emitted	 (trianglesCount);
+				std::vector <uint32_t> deadEnds;
+				std::vector <uint32_t> candidates;
+
+				std::vector <unsigned> result;
+				result.reserve(trianglesCount * 3);
+
+				auto	 time	= cacheSize + 1;
+				uint32_t cursor = 0;
+				uint32_t fan	= verticesCount != 0 ? 0 : null_vertex;
+
+				auto const skip_dead_end = [&] () noexcept
+				{
+					while (!deadEnds.empty()) {
+						auto const vertex = deadEnds.back();
+						deadEnds.pop_back();
+
+						if (live[vertex] > 0)
+							return vertex;
+					}
+
+					for (; cursor < verticesCount; ++cursor)
+						if (live[cursor] > 0)
+							return cursor;
+
+					return null_vertex;
+				};
+
+				while (fan != null_vertex)
+				{
+					candidates.clear();
+
+					for (auto i = offsets[fan]; i < offsets[fan + 1]; ++i)
+					{
+						auto const triangle = adjacency[i];
+
+						if (emitted[triangle])
+							continue;
+
+						for (size_t k = 0; k < 3; ++k)
+						{
+							auto const vertex = indices[3 * triangle + k];
+
+							result.push_back(vertex);
+							deadEnds.push_back(vertex);
+							candidates.push_back(vertex);
+
+							--live[vertex];
+
+							if (time - stamps[vertex] > cacheSize)
+								stamps[vertex] = time++;
+						}
+
+						emitted[triangle] = 1;
+					}
+
+					/* the vertex whose remaining triangles still fit the cache, the oldest in it first */
+					auto   next		= null_vertex;
+					size_t priority = 0;
+
+					for (auto const vertex : candidates)
+					{
+						if (live[vertex] == 0)
+							continue;
+
+						auto const age = time - stamps[vertex];
+						auto const fit = age + 2 * live[vertex] <= cacheSize ? age : 0;
+
+						if (next == null_vertex || fit > priority) {
+							next	 = vertex;
+							priority = fit;
+						}
+					}
+
+					if (next == null_vertex) {
+						next = skip_dead_end();
+						clusters.push_back(result.size() / 3);
+					}
+
+					fan = next;
+				}
+
+				/* the last restart found nothing, so it closes no cluster */
+				if (!clusters.empty())
+					clusters.pop_back();
+
+				return result;
+			}
+
+			/* the restarts of the fans are too rare to sort by them, so every cluster is cut again
+			   whenever the triangles since its last cut missed the cache about as much as the whole mesh */
+			_NODISCARD std::vector <size_t> split_clusters (
+				std::vector <unsigned> const& indices,
+				size_t verticesCount,
+				std::vector <size_t> const& clusters
+			) const {
+				auto const trianglesCount = indices.size() / 3;
+				auto const cacheSize	  = myConfig.cacheSize;
+				auto const target		  = get_acmr(indices, verticesCount, cacheSize) * myConfig.overdrawThreshold;
+
+				std::vector <size_t> stamps (verticesCount);
+				std::vector <size_t> result;
+
+				auto time = cacheSize + 1;
+
+				for (size_t c = 0; c <= clusters.size(); ++c)
+				{
+					auto const first = c == 0 ? 0 : clusters[c - 1];
+					auto const last	 = c == clusters.size() ? trianglesCount : clusters[c];
+
+					auto   start  = first;
+					size_t misses = 0;
+
+					/* every cluster starts with the cache flushed */
+					time += cacheSize + 1;
+
+					for (auto t = first; t < last; ++t)
+					{
+						for (size_t k = 0; k < 3; ++k)
+							if (auto const index = indices[3 * t + k]; time - stamps[index] > cacheSize) {
+								stamps[index] = time++;
+								++misses;
+							}
+
+						if (t + 1 < last && static_cast <double>(misses) <= target * static_cast <double>(t + 1 - start))
+						{
+							result.push_back(t + 1);
+
+							start  = t + 1;
+							misses = 0;
+							time  += cacheSize + 1;
+						}
+					}
+
+					if (c != clusters.size())
+						result.push_back(last);
+				}
+
+				return result;
+			}
+
+			/* the clusters are sorted by how far their faces look out of the mesh center */
+			_NODISCARD static std::vector <unsigned> reorder_clusters (
+				std::span <_VertexTy const> vertices,
+				std::vector <unsigned> const& indices,
+				std::vector <size_t> const& clusters
+			) {
+				auto const trianglesCount = indices.size() / 3;
+
+				auto const position = [&] (unsigned index) noexcept {
+					glm::dvec3 result { 0.0 };
+
+					for (glm::length_t k = 0; k < static_cast <glm::length_t>(Detail::VertexTraits<_VertexTy>::position_length()); ++k)
+						result[k] = static_cast <double>(vertices[index].position[k]);
+
+					return result;
+				};
+
+				glm::dvec3 center { 0.0 };
+				double	   total = 0.0;
+
+				struct Cluster
+				{
+					size_t first;
+					size_t last;
+					double sortKey;
+				};
+
+				std::vector <Cluster> order;
+				order.reserve(clusters.size() + 1);
+
+				std::vector <std::pair <glm::dvec3, glm::dvec3>> sums;
+				sums.reserve(clusters.size() + 1);
+
+				for (size_t i = 0; i <= clusters.size(); ++i)
+				{
+					auto const first = i == 0 ? 0 : clusters[i - 1];
+					auto const last	 = i == clusters.size() ? trianglesCount : clusters[i];
+
+					glm::dvec3 centroid { 0.0 };
+					glm::dvec3 normal	{ 0.0 };
+					double	   area = 0.0;
+
+					for (auto t = first; t < last; ++t)
+					{
+						auto const a = position(indices[3 * t]);
+						auto const b = position(indices[3 * t + 1]);
+						auto const c = position(indices[3 * t + 2]);
+
+						auto const cross  = glm::cross(b - a, c - a);
+						auto const weight = glm::length(cross);
+
+						centroid += (a + b + c) * (weight / 3.0);
+						normal	 += cross;
+						area	 += weight;
+					}
+
+					center += centroid;
+					total  += area;
+
+					order.push_back({ first, last, 0.0 });
+					sums.emplace_back(area > 0.0 ? centroid / area : centroid, normal);
+				}
+
+				if (total > 0.0)
+					center /= total;
+
+				for (size_t i = 0; i < order.size(); ++i)
+				{
+					auto const& [centroid, normal] = sums[i];
+					auto const	length			   = glm::length(normal);
+
+					order[i].sortKey = length > 0.0 ? glm::dot(centroid - center, normal / length) : 0.0;
+				}
+
+				std::ranges::stable_sort(order, std::greater{}, &Cluster::sortKey);
+
+				std::vector <unsigned> result;
+				result.reserve(indices.size());
+
+				for (auto const& cluster : order)
+					result.insert(result.end(), indices.begin() + 3 * cluster.first, indices.begin() + 3 * cluster.last);
+
+				return result;
+			}
+
+			_NODISCARD static mesh_type reorder_vertices (std::span <_VertexTy const> vertices, std::vector <unsigned> indices)
+			{
+				std::vector <uint32_t>	remap (vertices.size(), null_vertex);
+				std::vector <_VertexTy> result;
+
+				result.reserve(vertices.size());
+
+				for (auto& index : indices)
+				{
+					if (remap[index] == null_vertex) {
+						remap[index] = static_cast <uint32_t>(result.size());
+						result.push_back(vertices[index]);
+					}
+
+					index = remap[index];
+				}
+
+				return mesh_type{ std::move(result), std::move(indices) };
+			}
+
+			Configuration myConfig;
+		};
+	}
+}
\ No newline at end of file
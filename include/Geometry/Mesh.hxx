@@ -3,6 +3,7 @@
 #include "../Common.hxx"
 
 #include "Vertex.hxx"
+#include "Bounds.hxx"
 #include "GlmHelper.hxx"
 
 namespace Coli
@@ -12,9 +13,12 @@ namespace Coli
 		template <Detail::Vertex _VertexTy>
 		class Mesh final
 		{
-			using vector_type = glm::vec <Detail::VertexTraits<_VertexTy>::position_length(), double>;
+			using vector_type = typename Detail::VertexTraits<_VertexTy>::position_type;
+			using scalar_type = typename Detail::VertexTraits<_VertexTy>::scalar_type;
 			
 		public:
+			using bounds_type = BasicBounds <Detail::VertexTraits<_VertexTy>::is_2D(), scalar_type>;
+
 			template <Detail::IterableContainerOf <_VertexTy> _ContainerTy>
 			Mesh (_ContainerTy const& vertices)
 			{
@@ -40,6 +44,8 @@ namespace Coli
 				uniques.clear();
 				myVertices.shrink_to_fit();
 				myIndices.shrink_to_fit();
+
+				make_bounds();
 			}
 
 			template <class _VerticesTy, class _IndicesTy>
@@ -58,6 +64,8 @@ namespace Coli
 					myIndices = std::forward<_IndicesTy>(indices);
 				else
 					myIndices.assign(indices.begin(), indices.end());
+
+				make_bounds();
 			}
 
 			_NODISCARD std::span <_VertexTy const> get_vertices() const noexcept {
@@ -72,22 +80,51 @@ namespace Coli
 				return myIndices.size();
 			}
 
+			_NODISCARD bounds_type const& get_bounds() const noexcept {
+				return myBounds;
+			}
+
+			/* the radius of the sphere around the center of the bounds */
+			_NODISCARD scalar_type get_radius() const noexcept {
+				return myRadius;
+			}
+
 		private:
+			void make_bounds() noexcept
+			{
+				if (myVertices.empty())
+					return;
+
+				myBounds = { myVertices.front().position, myVertices.front().position };
+
+				for (auto const& vertex : myVertices)
+					myBounds = { glm::min(myBounds.min, vertex.position), glm::max(myBounds.max, vertex.position) };
+
+				auto const center = myBounds.get_center();
+
+				for (auto const& vertex : myVertices)
+					myRadius = std::max(myRadius, glm::distance(center, vertex.position));
+			}
+
 			std::vector <_VertexTy> myVertices;
 			std::vector <unsigned>  myIndices;
+
+			bounds_type myBounds;
+			scalar_type myRadius = 0;
 		};
 
 		template <Detail::Vertex _VertexTy>
 		class BoxMeshGenerator final
 		{
-			using position_type = glm::vec <Detail::VertexTraits<_VertexTy>::position_length(), double>;
-			using texcoord_type = glm::vec <Detail::VertexTraits<_VertexTy>::texcoord_length(), double>;
+			using position_type = typename Detail::VertexTraits<_VertexTy>::position_type;
+			using texcoord_type = typename Detail::VertexTraits<_VertexTy>::texcoord_type;
+			using scalar_type	= typename Detail::VertexTraits<_VertexTy>::scalar_type;
 
 			using vector_type = position_type;
 
 			_NODISCARD static constexpr std::vector <_VertexTy> gen_vertices(vector_type const& size)
 			{
-				auto const halfSize = size / 2.0;
+				auto const halfSize = size / scalar_type{ 2 };
 
 				if constexpr (Detail::VertexTraits<_VertexTy>::is_2D())
 					return {
@@ -161,16 +198,16 @@ namespace Coli
 		template <Detail::Vertex _VertexTy>
 		class SphereMeshGenerator final
 		{
-			using position_type = glm::vec <Detail::VertexTraits<_VertexTy>::position_length(), double>;
-			using texcoord_type = glm::vec <Detail::VertexTraits<_VertexTy>::texcoord_length(), double>;
+			using position_type = typename Detail::VertexTraits<_VertexTy>::position_type;
+			using texcoord_type = typename Detail::VertexTraits<_VertexTy>::texcoord_type;
 
 			using vector_type = position_type;
 
+			static constexpr unsigned min_density = 3;
+			static constexpr unsigned max_density = 100'000;
+
 			static void verify_density (unsigned density) 
 			{
-				auto constexpr min_density = 3;
-				auto constexpr max_density = 100'000;
-
 				if (density > max_density || density < min_density)
 					throw std::invalid_argument("Invalid density value");
 			}
@@ -202,7 +239,7 @@ namespace Coli
 						auto const u = static_cast<double>(j) / meridianDensity;
 						auto const v = static_cast<double>(i) / parallelDensity;
 
-						vertices.emplace_back(position_type{ x, y, z }, texcoord_type{ u, v });
+						vertices.emplace_back(position_type(x, y, z), texcoord_type(u, v));
 					}
 				}
 
@@ -245,6 +282,54 @@ namespace Coli
 
 				return Mesh <_VertexTy> { vertices, indices };
 			}
+
+			/* the levels of detail from the finest one, every next level halves both densities
+			   down to the minimal ones, the chain ends earlier once the densities cannot drop */
+			_NODISCARD std::vector <Mesh <_VertexTy>> operator()(double radius, unsigned meridians, unsigned parallels, size_t levels) const
+			{
+				verify_density (meridians);
+				verify_density (parallels);
+
+				std::vector <Mesh <_VertexTy>> chain;
+				chain.reserve(levels);
+
+				for (size_t level = 0; level < levels; ++level)
+				{
+					chain.push_back((*this)(radius, meridians, parallels));
+
+					if (meridians == min_density && parallels == min_density)
+						break;
+
+					meridians = std::max(min_density, meridians / 2);
+					parallels = std::max(min_density, parallels / 2);
+				}
+
+				return chain;
+			}
 		};
 	}
+}
+
+namespace std
+{
+	template <Coli::Detail::Vertex _VertexTy>
+	struct hash <Coli::Geometry::Mesh <_VertexTy>>
+	{
+		_NODISCARD size_t operator()(Coli::Geometry::Mesh <_VertexTy> const& val) const noexcept
+		{
+			Coli::Detail::HashMixer mixer;
+			size_t hash;
+
+			hash = mixer(val.get_vertices().size());
+			hash = mixer(val.get_indices().size(), hash);
+
+			for (auto const& vertex : val.get_vertices())
+				hash = mixer(std::hash<_VertexTy>{}(vertex), hash);
+
+			for (auto const index : val.get_indices())
+				hash = mixer(index, hash);
+
+			return hash;
+		}
+	};
 }
\ No newline at end of file
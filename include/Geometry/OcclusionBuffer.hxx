@@ -0,0 +1,398 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Mesh.hxx"
+#include "Bounds.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* the client side copy of a mesh rasterised into the occlusion buffer,
+		   usually a much simpler shape laying inside of the drawn one */
+		class Occluder final
+		{
+		public:
+			template <Detail::Vertex _VertexTy>
+			explicit Occluder (Mesh <_VertexTy> const& mesh) :
+				myIndices (mesh.get_indices().begin(), mesh.get_indices().end())
+			{
+				myPositions.reserve(mesh.get_vertices().size());
+
+				for (auto const& vertex : mesh.get_vertices())
+				{
+					if constexpr (Detail::VertexTraits <_VertexTy>::is_2D())
+						myPositions.emplace_back(glm::vec2(vertex.position), 0.f);
+					else
+						myPositions.emplace_back(vertex.position);
+				}
+			}
+
+			_NODISCARD std::span <glm::vec3 const> get_positions() const noexcept {
+				return myPositions;
+			}
+
+			_NODISCARD std::span <unsigned const> get_indices() const noexcept {
+				return myIndices;
+			}
+
+		private:
+			std::vector <glm::vec3> myPositions;
+			std::vector <unsigned>	myIndices;
+		};
+
+		/* a small depth buffer the occluders are rasterised into on the client, the screen is split into tiles
+		   which are rasterised in parallel four pixels at once, the tested bounds are compared with the farthest
+		   depths of the hierarchical levels, so the test reads only a few texels whatever the size of the bounds */
+		class OcclusionBuffer final
+		{
+			static void x_invalid_size() {
+				throw std::invalid_argument("The occlusion buffer sizes have to be powers of two not smaller than its tile");
+			}
+
+		public:
+			static constexpr size_t tile_size = 32;
+
+			static constexpr size_t default_width  = 256;
+			static constexpr size_t default_height = 128;
+
+			static constexpr float far_depth = 1.f;
+
+			explicit OcclusionBuffer (size_t width = default_width, size_t height = default_height) :
+				myWidth	 (width),
+				myHeight (height)
+			{
+				if (!std::has_single_bit(width) || !std::has_single_bit(height) || width < tile_size || height < tile_size)
+					x_invalid_size();
+
+				for (size_t level = 0; (width >> level) > 0 || (height >> level) > 0; ++level)
+					myLevels.emplace_back(get_level_width(level) * get_level_height(level), far_depth);
+
+				for (size_t y = 0; y < height; y += tile_size)
+				for (size_t x = 0; x < width;  x += tile_size)
+					myTiles.push_back({ x, y });
+			}
+
+			OcclusionBuffer(OcclusionBuffer&&)		= delete;
+			OcclusionBuffer(OcclusionBuffer const&) = delete;
+
+			OcclusionBuffer& operator=(OcclusionBuffer&&)	   = delete;
+			OcclusionBuffer& operator=(OcclusionBuffer const&) = delete;
+
+			void clear() noexcept
+			{
+				for (auto& level : myLevels)
+					std::ranges::fill(level, far_depth);
+
+				for (auto& tile : myTiles)
+					tile.triangles.clear();
+
+				myTriangles.clear();
+			}
+
+			/* the triangles are only projected and binned to the tiles, the rasterisation waits for all the occluders */
+			void add_occluder (Occluder const& occluder, glm::mat4 const& modelViewProjection)
+			{
+				auto const positions = occluder.get_positions();
+				auto const indices	 = occluder.get_indices();
+
+				myClipPositions.clear();
+				myClipPositions.reserve(positions.size());
+
+				for (auto const& position : positions)
+					myClipPositions.push_back(modelViewProjection * glm::vec4(position, 1.f));
+
+				for (size_t i = 0; i + 2 < indices.size(); i += 3)
+					add_triangle({ myClipPositions[indices[i]], myClipPositions[indices[i + 1]], myClipPositions[indices[i + 2]] });
+			}
+
+			void rasterize()
+			{
+				std::for_each (std::execution::par, myTiles.begin(), myTiles.end(), [this] (Tile const& tile) {
+					for (auto const index : tile.triangles)
+						rasterize_triangle(tile, myTriangles[index]);
+				});
+
+				build_levels();
+			}
+
+			/* conservative, the bounds crossing the near plane or leaving the screen are never occluded */
+			_NODISCARD bool is_occluded (BoundsF const& bounds, glm::mat4 const& viewProjection) const noexcept
+			{
+				glm::vec3 min { std::numeric_limits <float>::max() };
+				glm::vec3 max { std::numeric_limits <float>::lowest() };
+
+				for (unsigned i = 0; i < 8; ++i)
+				{
+					glm::vec3 const corner {
+						(i & 1) ? bounds.max.x : bounds.min.x,
+						(i & 2) ? bounds.max.y : bounds.min.y,
+						(i & 4) ? bounds.max.z : bounds.min.z
+					};
+
+					auto const clip = viewProjection * glm::vec4(corner, 1.f);
+
+					if (clip.w <= 0.f || clip.z < -clip.w)
+						return false;
+
+					auto const ndc = glm::vec3(clip) / clip.w;
+
+					min = glm::min(min, ndc);
+					max = glm::max(max, ndc);
+				}
+
+				auto const width  = static_cast <float>(myWidth);
+				auto const height = static_cast <float>(myHeight);
+
+				auto const left	  = (min.x * 0.5f + 0.5f) * width;
+				auto const right  = (max.x * 0.5f + 0.5f) * width;
+				auto const bottom = (min.y * 0.5f + 0.5f) * height;
+				auto const top	  = (max.y * 0.5f + 0.5f) * height;
+
+				if (left < 0.f || bottom < 0.f || right >= width || top >= height)
+					return false;
+
+				auto const nearest = min.z * 0.5f + 0.5f;
+
+				auto const x0 = static_cast <size_t>(left);
+				auto const x1 = static_cast <size_t>(right);
+				auto const y0 = static_cast <size_t>(bottom);
+				auto const y1 = static_cast <size_t>(top);
+
+				/* the first level where the bounds cover at most two texels in each direction */
+				size_t level = 0;
+
+				while (level + 1 < myLevels.size() && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+					++level;
+
+				auto const& depths		= myLevels[level];
+				auto const	levelWidth	= get_level_width(level);
+
+				for (auto y = y0 >> level; y <= y1 >> level; ++y)
+				for (auto x = x0 >> level; x <= x1 >> level; ++x)
+					if (depths[y * levelWidth + x] >= nearest)
+						return false;
+
+				return true;
+			}
+
+			_NODISCARD size_t get_width() const noexcept {
+				return myWidth;
+			}
+
+			_NODISCARD size_t get_height() const noexcept {
+				return myHeight;
+			}
+
+			/* the nearest depth of the pixel, from zero at the near plane to one at the far plane */
+			_NODISCARD float get_depth (size_t x, size_t y) const noexcept {
+				return myLevels.front()[y * myWidth + x];
+			}
+
+			_NODISCARD size_t get_triangles_count() const noexcept {
+				return myTriangles.size();
+			}
+
+		private:
+			/* in pixels and the depth of the buffer, counter clockwise */
+			struct Triangle
+			{
+				std::array <glm::vec3, 3> vertices;
+			};
+
+			struct Tile
+			{
+				size_t x;
+				size_t y;
+
+				std::vector <uint32_t> triangles;
+			};
+
+			_NODISCARD size_t get_level_width (size_t level) const noexcept {
+				return std::max <size_t>(1, myWidth >> level);
+			}
+
+			_NODISCARD size_t get_level_height (size_t level) const noexcept {
+				return std::max <size_t>(1, myHeight >> level);
+			}
+
+			/* the part of the triangle behind the near plane is clipped in the clip space */
+			void add_triangle (std::array <glm::vec4, 3> const& clip)
+			{
+				std::array <glm::vec4, 4> polygon;
+				size_t count = 0;
+
+				for (size_t i = 0; i < 3; ++i)
+				{
+					auto const& current = clip[i];
+					auto const& next	= clip[(i + 1) % 3];
+
+					auto const currentDistance = current.z + current.w;
+					auto const nextDistance	   = next.z	   + next.w;
+
+					if (currentDistance >= 0.f)
+						polygon[count++] = current;
+
+					if ((currentDistance >= 0.f) != (nextDistance >= 0.f))
+						polygon[count++] = glm::mix(current, next, currentDistance / (currentDistance - nextDistance));
+				}
+
+				for (size_t i = 1; i + 1 < count; ++i)
+					add_projected(polygon[0], polygon[i], polygon[i + 1]);
+			}
+
+			void add_projected (glm::vec4 const& a, glm::vec4 const& b, glm::vec4 const& c)
+			{
+				if (a.w <= 0.f || b.w <= 0.f || c.w <= 0.f)
+					return;
+
+				auto const project = [this] (glm::vec4 const& clip) noexcept
+				{
+					auto const ndc = glm::vec3(clip) / clip.w;
+
+					return glm::vec3 {
+						(ndc.x * 0.5f + 0.5f) * static_cast <float>(myWidth),
+						(ndc.y * 0.5f + 0.5f) * static_cast <float>(myHeight),
+						 ndc.z * 0.5f + 0.5f
+					};
+				};
+
+				Triangle triangle { project(a), project(b), project(c) };
+				auto& [p0, p1, p2] = triangle.vertices;
+
+				auto const area = (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x);
+
+				if (std::abs(area) <= std::numeric_limits <float>::epsilon())
+					return;
+
+				if (area < 0.f)
+					std::swap(p1, p2);
+
+				auto const min = glm::max(glm::min(glm::min(p0, p1), p2), glm::vec3{ 0.f });
+				auto const max = glm::min(glm::max(glm::max(p0, p1), p2), glm::vec3{ static_cast <float>(myWidth - 1), static_cast <float>(myHeight - 1), far_depth });
+
+				if (min.x > max.x || min.y > max.y || min.z > far_depth)
+					return;
+
+				auto const index = static_cast <uint32_t>(myTriangles.size());
+				myTriangles.push_back(triangle);
+
+				auto const tilesPerRow = myWidth / tile_size;
+
+				for (auto y = static_cast <size_t>(min.y) / tile_size; y <= static_cast <size_t>(max.y) / tile_size; ++y)
+				for (auto x = static_cast <size_t>(min.x) / tile_size; x <= static_cast <size_t>(max.x) / tile_size; ++x)
+					myTiles[y * tilesPerRow + x].triangles.push_back(index);
+			}
+
+			/* the edges and the depth are planes over the pixel centers, a pixel is covered when all the edges are non negative */
+			void rasterize_triangle (Tile const& tile, Triangle const& triangle)
+			{
+				auto const& [p0, p1, p2] = triangle.vertices;
+
+				auto const edge = [] (glm::vec3 const& from, glm::vec3 const& to) noexcept {
+					return glm::vec3{ from.y - to.y, to.x - from.x, (to.y - from.y) * from.x - (to.x - from.x) * from.y };
+				};
+
+				/* every edge weights the vertex in front of it */
+				auto const e0 = edge(p1, p2);
+				auto const e1 = edge(p2, p0);
+				auto const e2 = edge(p0, p1);
+
+				auto const area  = e0.x * p0.x + e0.y * p0.y + e0.z;
+				auto const depth = (e0 * p0.z + e1 * p1.z + e2 * p2.z) / area;
+
+				auto const min = glm::min(glm::min(p0, p1), p2);
+				auto const max = glm::max(glm::max(p0, p1), p2);
+
+				/* the groups of four pixels start at the multiples of four, the tiles are made of whole groups */
+				auto const x0 = std::max(tile.x, static_cast <size_t>(std::max(min.x, 0.f)) & ~size_t{ 3 });
+				auto const y0 = std::max(tile.y, static_cast <size_t>(std::max(min.y, 0.f)));
+				auto const x1 = std::min(tile.x + tile_size, static_cast <size_t>(std::max(max.x, 0.f)) + 1);
+				auto const y1 = std::min(tile.y + tile_size, static_cast <size_t>(std::max(max.y, 0.f)) + 1);
+
+				auto& depths = myLevels.front();
+
+				for (auto y = y0; y < y1; ++y)
+				{
+					auto const centerY = static_cast <float>(y) + 0.5f;
+					auto* const row	   = depths.data() + y * myWidth;
+
+					for (auto x = x0; x < x1; x += 4)
+					{
+						auto const centerX = static_cast <float>(x) + 0.5f;
+#ifdef COLI_SSE
+						auto const xs = _mm_add_ps(_mm_set1_ps(centerX), _mm_setr_ps(0.f, 1.f, 2.f, 3.f));
+						auto const ys = _mm_set1_ps(centerY);
+
+						auto const evaluate = [&xs, &ys] (glm::vec3 const& plane) noexcept {
+							return _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, _mm_set1_ps(plane.x)), _mm_mul_ps(ys, _mm_set1_ps(plane.y))), _mm_set1_ps(plane.z));
+						};
+
+						auto const zero	   = _mm_setzero_ps();
+						auto const covered = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(evaluate(e0), zero),
+																   _mm_cmpge_ps(evaluate(e1), zero)),
+																   _mm_cmpge_ps(evaluate(e2), zero));
+
+						if (_mm_movemask_ps(covered) == 0)
+							continue;
+
+						auto const previous = _mm_loadu_ps(row + x);
+						auto const nearest	= _mm_min_ps(previous, evaluate(depth));
+
+						_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(covered, nearest), _mm_andnot_ps(covered, previous)));
+#else
+						for (size_t lane = 0; lane < 4; ++lane)
+						{
+							glm::vec3 const center { centerX + static_cast <float>(lane), centerY, 1.f };
+
+							if (glm::dot(e0, center) >= 0.f && glm::dot(e1, center) >= 0.f && glm::dot(e2, center) >= 0.f)
+								row[x + lane] = std::min(row[x + lane], glm::dot(depth, center));
+						}
+#endif
+					}
+				}
+			}
+
+			/* every texel of a level keeps the farthest depth of the four texels below it */
+			void build_levels() noexcept
+			{
+				for (size_t level = 1; level < myLevels.size(); ++level)
+				{
+					auto const& source = myLevels[level - 1];
+					auto&		target = myLevels[level];
+
+					auto const sourceWidth	= get_level_width(level - 1);
+					auto const sourceHeight = get_level_height(level - 1);
+					auto const targetWidth	= get_level_width(level);
+					auto const targetHeight = get_level_height(level);
+
+					for (size_t y = 0; y < targetHeight; ++y)
+					for (size_t x = 0; x < targetWidth;  ++x)
+					{
+						auto const left	  = std::min(2 * x, sourceWidth  - 1);
+						auto const right  = std::min(2 * x + 1, sourceWidth  - 1);
+						auto const bottom = std::min(2 * y, sourceHeight - 1);
+						auto const top	  = std::min(2 * y + 1, sourceHeight - 1);
+
+						target[y * targetWidth + x] = std::max({
+							source[bottom * sourceWidth + left], source[bottom * sourceWidth + right],
+							source[top	  * sourceWidth + left], source[top	   * sourceWidth + right]
+						});
+					}
+				}
+			}
+
+			size_t myWidth;
+			size_t myHeight;
+
+			/* the first level is the depth buffer itself */
+			std::vector <std::vector <float>> myLevels;
+
+			std::vector <Triangle>	myTriangles;
+			std::vector <Tile>		myTiles;
+			std::vector <glm::vec4> myClipPositions;
+		};
+	}
+}
\ No newline at end of file
@@ -10,10 +10,50 @@ namespace Coli
 {
 	namespace Geometry
 	{
-		template <bool _Use2D>
+		/* static bodies never move, kinematic ones are moved by their transform only */
+		enum class BodyType {
+			dynamic_body,
+			kinematic_body,
+			static_body
+		};
+
+		/* a trivially copyable record of a body and its transform used by the binary snapshots */
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		struct BasicBodySnapshot
+		{
+			using vector_type  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using rotator_type = Detail::rotator_t <_Use2D, _ScalarTy>;
+
+			size_t key;
+			size_t index;
+
+			rotator_type rotation;
+			vector_type	 position;
+			vector_type	 scale;
+
+			vector_type velocity;
+			vector_type forces;
+			vector_type maxVelocity;
+
+			_ScalarTy collideRestitution;
+			_ScalarTy movingResistance;
+			_ScalarTy mass;
+			_ScalarTy gravity;
+
+			BodyType type;
+
+			bool hasTransform;
+			bool hasMaxVelocity;
+			bool continuous;
+			bool hasStateFlags;
+
+			uint8_t stateFlags;
+		};
+
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
 		class BasicPhysicalBody
 		{
-			using vector_type = glm::vec <_Use2D ? 2 : 3, double>;
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
 
 			void apply_position_correction (vector_type const& diff) noexcept {
 				if (auto transform = myTransform.lock())
@@ -32,6 +72,8 @@ namespace Coli
 				myMaxVelocity		= other.myMaxVelocity;
 				myForcesAccumulator = other.myForcesAccumulator;
 				myVelocity			= other.myVelocity;
+				myContinuousFlag	= other.myContinuousFlag;
+				myType				= other.myType;
 
 				collideRestitution = other.collideRestitution;
 				movingResistance   = other.movingResistance;
@@ -41,7 +83,7 @@ namespace Coli
 				return *this;
 			}
 
-			void report_force (vector_type const& direction, double magnitude) noexcept {
+			void report_force (vector_type const& direction, _ScalarTy magnitude) noexcept {
 				myForcesAccumulator += magnitude / mass * direction;
 			}
 
@@ -49,7 +91,7 @@ namespace Coli
 				myForcesAccumulator += force / mass;
 			}
 
-			void apply_force (vector_type const& direction, double magnitude, float time) noexcept
+			void apply_force (vector_type const& direction, _ScalarTy magnitude, float time = 1.f) noexcept
 			{
 				myVelocity += time * magnitude / mass * direction;
 
@@ -61,7 +103,7 @@ namespace Coli
 			{
 				myVelocity.y -= time * mass * gravity;
 				
-				myVelocity -= time / (1.0 - glm::clamp (movingResistance, 0.0, 1.0)) * myVelocity;
+				myVelocity -= time / (_ScalarTy{ 1 } - glm::clamp (movingResistance, _ScalarTy{ 0 }, _ScalarTy{ 1 })) * myVelocity;
 				myVelocity += time / mass * myForcesAccumulator;
 
 				if (myMaxVelocity.has_value())
@@ -71,8 +113,110 @@ namespace Coli
 			}
 
 			void apply_velocity (float time) noexcept {
+				apply_displacement (get_displacement(time));
+			}
+
+			void apply_displacement (vector_type const& displacement) noexcept {
 				if (auto transform = myTransform.lock())
-					transform->position += myVelocity * static_cast<double>(time);
+					transform->position += displacement;
+			}
+
+			/* the transform keeps its state from before the step only while the body moves */
+			void track_transform (vector_type const& displacement)
+			{
+				if (auto transform = myTransform.lock())
+				{
+					if (glm::length2(displacement) > 0)
+						transform->keep_previous_state();
+					else
+						transform->forget_previous_state();
+				}
+			}
+
+			_NODISCARD vector_type get_displacement (float time) const noexcept {
+				return myVelocity * static_cast<_ScalarTy>(time);
+			}
+
+			_NODISCARD vector_type const& get_velocity() const noexcept {
+				return myVelocity;
+			}
+
+			void enable_continuous_collision() noexcept {
+				myContinuousFlag = true;
+			}
+
+			void disable_continuous_collision() noexcept {
+				myContinuousFlag = false;
+			}
+
+			_NODISCARD bool has_continuous_collision() const noexcept {
+				return myContinuousFlag;
+			}
+
+			_NODISCARD BodyType get_type() const noexcept {
+				return myType;
+			}
+
+			void set_type (BodyType type) noexcept {
+				myType = type;
+			}
+
+			_NODISCARD bool is_dynamic() const noexcept {
+				return myType == BodyType::dynamic_body;
+			}
+
+			/* the key, the index and the state flags are left to the caller */
+			void capture (BasicBodySnapshot <_Use2D, _ScalarTy>& snapshot) const noexcept
+			{
+				auto const transform = myTransform.lock();
+
+				if ((snapshot.hasTransform = transform != nullptr)) {
+					snapshot.rotation = transform->rotation;
+					snapshot.position = transform->position;
+					snapshot.scale	  = transform->scale;
+				}
+
+				snapshot.velocity	 = myVelocity;
+				snapshot.forces		 = myForcesAccumulator;
+				snapshot.maxVelocity = myMaxVelocity.value_or(vector_type{ 0 });
+
+				snapshot.collideRestitution = collideRestitution;
+				snapshot.movingResistance	= movingResistance;
+				snapshot.mass				= mass;
+				snapshot.gravity			= gravity;
+
+				snapshot.type			= myType;
+				snapshot.hasMaxVelocity = myMaxVelocity.has_value();
+				snapshot.continuous		= myContinuousFlag;
+			}
+
+			void restore (BasicBodySnapshot <_Use2D, _ScalarTy> const& snapshot) noexcept
+			{
+				if (snapshot.hasTransform)
+					if (auto transform = myTransform.lock()) {
+						transform->rotation = snapshot.rotation;
+						transform->position = snapshot.position;
+						transform->scale	= snapshot.scale;
+
+						/* the restored transform jumps, blending it with the state before the jump would sweep across */
+						transform->forget_previous_state();
+					}
+
+				myVelocity			= snapshot.velocity;
+				myForcesAccumulator = snapshot.forces;
+
+				if (snapshot.hasMaxVelocity)
+					myMaxVelocity.emplace(snapshot.maxVelocity);
+				else
+					myMaxVelocity.reset();
+
+				collideRestitution = snapshot.collideRestitution;
+				movingResistance   = snapshot.movingResistance;
+				mass			   = snapshot.mass;
+				gravity			   = snapshot.gravity;
+
+				myType			 = snapshot.type;
+				myContinuousFlag = snapshot.continuous;
 			}
 
 			void limit_velocity (vector_type const& max) noexcept {
@@ -84,8 +228,8 @@ namespace Coli
 			}
 
 			void report_collision(
-				BasicPhysicalBody const& other,
-				BasicCollision<_Use2D> const& collision
+				BasicPhysicalBody& other,
+				BasicCollision<_Use2D, _ScalarTy> const& collision
 			) noexcept 
 			{
 				auto const relativeVelocity = myVelocity - other.myVelocity;
@@ -103,8 +247,8 @@ namespace Coli
 				}
 				else if (product < 0)
 				{
-					auto myRestitution    = glm::clamp (collideRestitution, 0.0, 1.0);
-					auto otherRestitution = glm::clamp (other.collideRestitution, 0.0, 1.0);
+					auto myRestitution    = glm::clamp (collideRestitution, _ScalarTy{ 0 }, _ScalarTy{ 1 });
+					auto otherRestitution = glm::clamp (other.collideRestitution, _ScalarTy{ 0 }, _ScalarTy{ 1 });
 
 					auto const restFactor = -1 - myRestitution * otherRestitution;
 					auto const massFactor = 1 / mass + 1 / other.mass;
@@ -118,16 +262,16 @@ namespace Coli
 				}
 			}
 
-			void report_collision(BasicCollision<_Use2D> const& collision) noexcept 
+			void report_collision(BasicCollision<_Use2D, _ScalarTy> const& collision) noexcept 
 			{
-				auto const restitution       = glm::clamp(collideRestitution, 0.0, 1.0);
+				auto const restitution       = glm::clamp(collideRestitution, _ScalarTy{ 0 }, _ScalarTy{ 1 });
 				auto const reflectedVelocity = (-1 - restitution) * myVelocity;
 				auto const force			 = glm::dot(reflectedVelocity, collision.normal) * mass;
 
 				this->apply_force(collision.normal, force);
 			}
 
-			void bind_transform(std::weak_ptr <Geometry::BasicTransform <_Use2D>> transform) noexcept {
+			void bind_transform(std::weak_ptr <Geometry::BasicTransform <_Use2D, _ScalarTy>> transform) noexcept {
 				myTransform.swap(transform);
 			}
 
@@ -139,29 +283,42 @@ namespace Coli
 			}
 
 		private:
-			std::weak_ptr <Geometry::BasicTransform <_Use2D>> myTransform;
+			std::weak_ptr <Geometry::BasicTransform <_Use2D, _ScalarTy>> myTransform;
 
 			std::optional <vector_type> myMaxVelocity;
 
-			vector_type myForcesAccumulator { 0.0 };
-			vector_type myVelocity			{ 0.0 };
+			vector_type myForcesAccumulator { 0 };
+			vector_type myVelocity			{ 0 };
+
+			bool myContinuousFlag = false;
+
+			BodyType myType = BodyType::dynamic_body;
 
 		public:
-			double collideRestitution = 0.8;
-			double movingResistance   = 0.075;
-			double mass				  = 1;
-			double gravity			  = 10;
+			_ScalarTy collideRestitution = _ScalarTy(0.8);
+			_ScalarTy movingResistance	 = _ScalarTy(0.075);
+			_ScalarTy mass				 = 1;
+			_ScalarTy gravity			 = 10;
 		};
 		
+		using BodySnapshot	 = BasicBodySnapshot <false>;
+		using BodySnapshot2D = BasicBodySnapshot <true>;
+
 		using PhysicalBody   = BasicPhysicalBody <false>;
 		using PhysicalBody2D = BasicPhysicalBody <true>;
+
+		using BodySnapshotF	  = BasicBodySnapshot <false, float>;
+		using BodySnapshot2DF = BasicBodySnapshot <true,  float>;
+
+		using PhysicalBodyF	  = BasicPhysicalBody <false, float>;
+		using PhysicalBody2DF = BasicPhysicalBody <true,  float>;
 	}
 }
 
 namespace nlohmann
 {
-	template <bool _Use2D>
-	struct adl_serializer <Coli::Geometry::BasicPhysicalBody<_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct adl_serializer <Coli::Geometry::BasicPhysicalBody<_Use2D, _ScalarTy>>
 	{
 	private:
 		struct Keys {
@@ -172,10 +329,12 @@ namespace nlohmann
 			static constexpr std::string_view gravity       = "gravity";
 			static constexpr std::string_view collide_rest  = "collideRestitution";
 			static constexpr std::string_view moving_resist = "movingResistance";
+			static constexpr std::string_view continuous	= "continuousCollision";
+			static constexpr std::string_view type			= "bodyType";
 		};
 
 	public:
-		static void to_json(json& j, Coli::Geometry::BasicPhysicalBody<_Use2D> const& val)
+		static void to_json(json& j, Coli::Geometry::BasicPhysicalBody<_Use2D, _ScalarTy> const& val)
 		{
 			j [Keys::velocity]     = val.myVelocity;
 			j [Keys::max_velocity] = val.myMaxVelocity;
@@ -184,9 +343,11 @@ namespace nlohmann
 			j [Keys::gravity]	    = val.gravity;
 			j [Keys::collide_rest]  = val.collideRestitution;
 			j [Keys::moving_resist] = val.movingResistance;
+			j [Keys::continuous]	= val.myContinuousFlag;
+			j [Keys::type]			= val.myType;
 		}
 
-		static void from_json (const json& j, Coli::Geometry::BasicPhysicalBody<_Use2D>& val)
+		static void from_json (const json& j, Coli::Geometry::BasicPhysicalBody<_Use2D, _ScalarTy>& val)
 		{
 			using Coli::Detail::Json::try_fill;
 
@@ -208,6 +369,18 @@ namespace nlohmann
 			decltype (val.movingResistance) tempMovingResistance;
 			try_fill (j, tempMovingResistance, Keys::moving_resist);
 
+			/* the bodies saved before the flag keep it off */
+			decltype (val.myContinuousFlag) tempContinuous = false;
+
+			if (j.contains(Keys::continuous))
+				try_fill (j, tempContinuous, Keys::continuous);
+
+			/* the bodies saved before the types were all dynamic */
+			decltype (val.myType) tempType = Coli::Geometry::BodyType::dynamic_body;
+
+			if (j.contains(Keys::type))
+				try_fill (j, tempType, Keys::type);
+
 			val.myVelocity    = tempVelocity;
 			val.myMaxVelocity = tempMaxVelocity;
 
@@ -215,6 +388,8 @@ namespace nlohmann
 			val.gravity			   = tempGravity;
 			val.collideRestitution = tempCollideRestitution;
 			val.movingResistance   = tempMovingResistance;
+			val.myContinuousFlag   = tempContinuous;
+			val.myType			   = tempType;
 		}
 	};
 }
\ No newline at end of file
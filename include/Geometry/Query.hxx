@@ -0,0 +1,56 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		struct QueryFilter
+		{
+			static constexpr uint32_t all_categories = std::numeric_limits <uint32_t>::max();
+			static constexpr size_t	  no_key		 = std::numeric_limits <size_t>::max();
+
+			_NODISCARD constexpr bool accepts (size_t key, uint32_t category) const noexcept {
+				return key != ignoredKey && (category & mask) != 0;
+			}
+
+			uint32_t mask		= all_categories;
+			size_t	 ignoredKey = no_key;
+		};
+
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		struct BasicRay
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+
+			vector_type origin;
+			vector_type direction;
+			_ScalarTy	maxDistance = std::numeric_limits <_ScalarTy>::max();
+		};
+
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		struct BasicQueryHit
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+
+			size_t		key;
+			_ScalarTy	distance;
+			vector_type point;
+			vector_type normal;
+		};
+
+		using Ray   = BasicRay <false>;
+		using Ray2D = BasicRay <true>;
+
+		using QueryHit   = BasicQueryHit <false>;
+		using QueryHit2D = BasicQueryHit <true>;
+
+		using RayF   = BasicRay <false, float>;
+		using Ray2DF = BasicRay <true,  float>;
+
+		using QueryHitF   = BasicQueryHit <false, float>;
+		using QueryHit2DF = BasicQueryHit <true,  float>;
+	}
+}
\ No newline at end of file
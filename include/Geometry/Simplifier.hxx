@@ -0,0 +1,604 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Mesh.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		/* the sum of the squared distances to a set of planes, every plane weighted by the area of its triangle */
+		class Quadric final
+		{
+		public:
+			Quadric() noexcept = default;
+
+			Quadric (glm::dvec3 const& normal, double distance, double weight) noexcept :
+				myXX (normal.x * normal.x * weight), myXY (normal.x * normal.y * weight), myXZ (normal.x * normal.z * weight),
+				myYY (normal.y * normal.y * weight), myYZ (normal.y * normal.z * weight), myZZ (normal.z * normal.z * weight),
+				myXW (normal.x * distance * weight), myYW (normal.y * distance * weight), myZW (normal.z * distance * weight),
+				myWW (distance * distance * weight),
+				myWeight (weight)
+			{}
+
+			Quadric& operator+=(Quadric const& other) noexcept
+			{
+				myXX += other.myXX; myXY += other.myXY; myXZ += other.myXZ;
+				myYY += other.myYY; myYZ += other.myYZ; myZZ += other.myZZ;
+				myXW += other.myXW; myYW += other.myYW; myZW += other.myZW;
+				myWW += other.myWW;
+
+				myWeight += other.myWeight;
+				return *this;
+			}
+
+			_NODISCARD Quadric operator+(Quadric const& other) const noexcept {
+				return Quadric{ *this } += other;
+			}
+
+			/* the mean squared distance of the point to the planes */
+			_NODISCARD double evaluate (glm::dvec3 const& point) const noexcept
+			{
+				auto const& [x, y, z] = std::tie(point.x, point.y, point.z);
+
+				auto const sum = x * x * myXX + 2.0 * x * y * myXY + 2.0 * x * z * myXZ
+							   + y * y * myYY + 2.0 * y * z * myYZ + z * z * myZZ
+							   + 2.0 * (x * myXW + y * myYW + z * myZW) + myWW;
+
+				return myWeight > 0.0 ? std::max(0.0, sum) / myWeight : 0.0;
+			}
+
+		private:
+			double myXX = 0, myXY = 0, myXZ = 0;
+			double myYY = 0, myYZ = 0, myZZ = 0;
+			double myXW = 0, myYW = 0, myZW = 0;
+			double myWW = 0;
+
+			double myWeight = 0;
+		};
+
+		/* a part of a mesh simplified on its own by the collapses of the edges into one of their ends,
+		   so no vertex is ever made up and the texcoords stay exact, the locked vertices never move */
+		class SimplifierPatch final
+		{
+		public:
+			using triangle_type = std::array <uint32_t, 3>;
+
+		private:
+			enum class State : uint8_t { free, locked, removed };
+
+			struct Candidate
+			{
+				_NODISCARD bool operator<(Candidate const& other) const noexcept {
+					return cost < other.cost;
+				}
+
+				double	 cost;
+				uint32_t from;
+				uint32_t to;
+			};
+
+			/* the open edges are kept in place by the planes standing on them */
+			static constexpr double border_weight = 16.0;
+
+			/* the share of the cheapest candidates collapsed by one pass before all the costs are updated */
+			static constexpr double pass_ratio = 0.25;
+
+			_NODISCARD static bool contains (triangle_type const& triangle, uint32_t vertex) noexcept {
+				return triangle[0] == vertex || triangle[1] == vertex || triangle[2] == vertex;
+			}
+
+			_NODISCARD glm::dvec3 get_normal (triangle_type const& triangle) const noexcept
+			{
+				auto const& a = myPositions[triangle[0]];
+				return glm::cross(myPositions[triangle[1]] - a, myPositions[triangle[2]] - a);
+			}
+
+			void make_quadrics()
+			{
+				myQuadrics.assign(myPositions.size(), {});
+
+				for (auto const& triangle : myTriangles)
+				{
+					auto const normal = get_normal(triangle);
+					auto const area	  = glm::length(normal);
+
+					if (area <= 0.0)
+						continue;
+
+					auto const unit = normal / area;
+					Quadric const quadric { unit, -glm::dot(unit, myPositions[triangle[0]]), area / 2.0 };
+
+					for (auto const vertex : triangle)
+						myQuadrics[vertex] += quadric;
+				}
+
+				for (uint32_t t = 0; t < myTriangles.size(); ++t)
+				{
+					auto const& triangle = myTriangles[t];
+					auto const	normal	 = get_normal(triangle);
+
+					for (size_t k = 0; k < 3; ++k)
+					{
+						auto const from = triangle[k];
+						auto const to	= triangle[(k + 1) % 3];
+
+						auto const shared = std::ranges::any_of(myAdjacency[from], [&] (uint32_t other) noexcept {
+												return other != t && contains(myTriangles[other], to);
+											});
+
+						if (shared)
+							continue;
+
+						auto const edge	  = myPositions[to] - myPositions[from];
+						auto const across = glm::cross(edge, normal);
+						auto const length = glm::length(across);
+
+						if (length <= 0.0)
+							continue;
+
+						auto const unit = across / length;
+						Quadric const quadric { unit, -glm::dot(unit, myPositions[from]), glm::dot(edge, edge) * border_weight };
+
+						myQuadrics[from] += quadric;
+						myQuadrics[to]	 += quadric;
+					}
+				}
+			}
+
+			/* the cheapest edge leaving the vertex */
+			_NODISCARD std::optional <Candidate> get_best (uint32_t from) const noexcept
+			{
+				std::optional <Candidate> best;
+
+				for (auto const t : myAdjacency[from])
+				{
+					if (myRemoved[t])
+						continue;
+
+					for (auto const to : myTriangles[t])
+					{
+						if (to == from)
+							continue;
+
+						auto const cost = (myQuadrics[from] + myQuadrics[to]).evaluate(myPositions[to]);
+
+						if (!best || cost < best->cost)
+							best = Candidate{ cost, from, to };
+					}
+				}
+
+				return best;
+			}
+
+			/* the edge must still exist, no remaining triangle may turn over or collapse
+			   into a line and the degenerate ones may only stay degenerate */
+			_NODISCARD bool can_collapse (uint32_t from, uint32_t to) const noexcept
+			{
+				auto connected = false;
+
+				for (auto const t : myAdjacency[from])
+				{
+					auto const& triangle = myTriangles[t];
+
+					if (myRemoved[t])
+						continue;
+
+					if (contains(triangle, to)) {
+						connected = true;
+						continue;
+					}
+
+					auto moved = triangle;
+					std::ranges::replace(moved, from, to);
+
+					auto const before = get_normal(triangle);
+					auto const after  = get_normal(moved);
+
+					if (glm::dot(before, after) <= 0.0 && (glm::dot(before, before) > 0.0 || glm::dot(after, after) > 0.0))
+						return false;
+				}
+
+				return connected;
+			}
+
+			void collapse (uint32_t from, uint32_t to)
+			{
+				for (auto const t : myAdjacency[from])
+				{
+					auto& triangle = myTriangles[t];
+
+					if (myRemoved[t])
+						continue;
+
+					if (contains(triangle, to)) {
+						myRemoved[t] = 1;
+						--myAlive;
+					}
+					else {
+						std::ranges::replace(triangle, from, to);
+						myAdjacency[to].push_back(t);
+					}
+				}
+
+				myQuadrics[to] += myQuadrics[from];
+				myStates[from]	= State::removed;
+
+				myAdjacency[from].clear();
+				myAdjacency[from].shrink_to_fit();
+
+				std::erase_if(myAdjacency[to], [this] (uint32_t t) noexcept {
+					return myRemoved[t] != 0;
+				});
+			}
+
+		public:
+			SimplifierPatch (
+				std::vector <glm::dvec3>	positions,
+				std::vector <uint8_t> const& locked,
+				std::vector <triangle_type> triangles
+			) :
+				myPositions (std::move(positions)),
+				myTriangles (std::move(triangles)),
+				myAlive		(myTriangles.size())
+			{
+				myStates.resize(myPositions.size());
+				myTouched.resize(myPositions.size());
+				myAdjacency.resize(myPositions.size());
+				myRemoved.resize(myTriangles.size());
+
+				for (size_t i = 0; i < myStates.size(); ++i)
+					myStates[i] = locked[i] ? State::locked : State::free;
+
+				for (uint32_t t = 0; t < myTriangles.size(); ++t)
+					for (auto const vertex : myTriangles[t])
+						myAdjacency[vertex].push_back(t);
+			}
+
+			SimplifierPatch(SimplifierPatch&&)		= default;
+			SimplifierPatch(SimplifierPatch const&) = delete;
+
+			SimplifierPatch& operator=(SimplifierPatch&&)	   = default;
+			SimplifierPatch& operator=(SimplifierPatch const&) = delete;
+
+			/* collapses the cheapest edges until the target count of the triangles or until the next collapse
+			   moves a vertex further than the squared error, every pass touches a vertex only once and the
+			   candidates are sorted again after it, which is much cheaper than a heap kept up to date */
+			void simplify (size_t target, double maxError)
+			{
+				make_quadrics();
+
+				std::vector <Candidate> candidates;
+
+				while (myAlive > target)
+				{
+					candidates.clear();
+
+					for (uint32_t vertex = 0; vertex < myPositions.size(); ++vertex)
+						if (myStates[vertex] == State::free)
+							if (auto const best = get_best(vertex); best && best->cost <= maxError)
+								candidates.push_back(*best);
+
+					if (candidates.empty())
+						break;
+
+					auto const count = std::max<size_t>(1, static_cast <size_t>(static_cast <double>(candidates.size()) * pass_ratio));
+					auto const last	 = candidates.begin() + static_cast <ptrdiff_t>(count);
+
+					std::nth_element(candidates.begin(), last - 1, candidates.end());
+					std::sort(candidates.begin(), last);
+					std::ranges::fill(myTouched, uint8_t{ 0 });
+
+					size_t collapsed = 0;
+
+					for (auto iter = candidates.begin(); iter != last && myAlive > target; ++iter)
+					{
+						auto const [cost, from, to] = *iter;
+
+						if (myTouched[from] || myTouched[to] || myStates[to] == State::removed || !can_collapse(from, to))
+							continue;
+
+						/* the vertices around the collapse keep their outdated costs until the next pass */
+						myTouched[from] = myTouched[to] = 1;
+
+						collapse(from, to);
+						++collapsed;
+					}
+
+					if (collapsed == 0)
+						break;
+				}
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return myAlive;
+			}
+
+			template <std::invocable <triangle_type const&> _FnTy>
+			void for_each_triangle (_FnTy&& fn) const
+			{
+				for (size_t t = 0; t < myTriangles.size(); ++t)
+					if (!myRemoved[t])
+						std::invoke(fn, myTriangles[t]);
+			}
+
+		private:
+			std::vector <glm::dvec3>	myPositions;
+			std::vector <triangle_type> myTriangles;
+
+			std::vector <State>	   myStates;
+			std::vector <uint8_t>  myTouched;
+			std::vector <Quadric>  myQuadrics;
+			std::vector <uint8_t>  myRemoved;
+
+			std::vector <std::vector <uint32_t>> myAdjacency;
+
+			size_t myAlive;
+		};
+	}
+
+	namespace Geometry
+	{
+		/* the quadric error simplification, the mesh is split into slabs of its triangles simplified in parallel
+		   with their shared vertices locked, then one more pass over the whole mesh collapses the slab borders */
+		template <Detail::Vertex _VertexTy>
+		class MeshSimplifier final
+		{
+			using mesh_type		= Mesh <_VertexTy>;
+			using triangle_type = Detail::SimplifierPatch::triangle_type;
+
+			static constexpr uint32_t unowned = std::numeric_limits <uint32_t>::max();
+			static constexpr uint32_t shared  = unowned - 1;
+
+		public:
+			struct Configuration {
+				/* zero leaves the simplification to the error alone */
+				size_t targetTriangles = 0;
+				/* the largest distance of a collapsed vertex to its original surface relative to the mesh radius, the infinity leaves the simplification to the target alone */
+				double maxError = 0.01;
+				/* the vertices sharing the position with another texcoords never move, so the seams stay closed */
+				bool preserveSeams = true;
+				/* zero picks one chunk per hardware thread */
+				size_t chunks = 0;
+			};
+
+			/* the distance relative to the radius under which two positions are one */
+			static constexpr double weld_tolerance = 1e-6;
+
+			/* smaller chunks would spend more on their borders than on their inside */
+			static constexpr size_t min_chunk_triangles = 1 << 14;
+
+			explicit MeshSimplifier (Configuration const& config = {}) noexcept :
+				myConfig (config)
+			{}
+
+			_NODISCARD mesh_type operator()(mesh_type const& mesh) const
+			{
+				auto const vertices = mesh.get_vertices();
+				auto const indices	= mesh.get_indices();
+
+				std::vector <triangle_type> triangles (indices.size() / 3);
+
+				for (size_t t = 0; t < triangles.size(); ++t)
+					triangles[t] = { indices[3 * t], indices[3 * t + 1], indices[3 * t + 2] };
+
+				std::vector <glm::dvec3> positions (vertices.size());
+
+				for (size_t i = 0; i < vertices.size(); ++i)
+					for (glm::length_t k = 0; k < static_cast <glm::length_t>(Detail::VertexTraits<_VertexTy>::position_length()); ++k)
+						positions[i][k] = static_cast <double>(vertices[i].position[k]);
+
+				auto const distance = myConfig.maxError * static_cast <double>(mesh.get_radius());
+				auto const error	= std::isinf(distance) ? std::numeric_limits <double>::max() : distance * distance;
+
+				auto const locked = make_seams(positions, static_cast <double>(mesh.get_radius()));
+				auto const target = std::min(myConfig.targetTriangles, triangles.size());
+
+				auto const threads = myConfig.chunks != 0 ? myConfig.chunks : std::max(1u, std::thread::hardware_concurrency());
+				auto const chunks  = std::clamp<size_t>(triangles.size() / min_chunk_triangles, 1, threads);
+
+				if (chunks > 1)
+					triangles = simplify_chunks(positions, locked, std::move(triangles), chunks, target, error);
+
+				Detail::SimplifierPatch patch { positions, locked, std::move(triangles) };
+				patch.simplify(target, error);
+
+				return compact(vertices, patch);
+			}
+
+			/* the chain starts with the mesh itself, every next level keeps the ratio of the triangles
+			   of the previous one whatever the configured error, the coarse levels are meant to be coarse,
+			   the chain ends earlier once a level cannot be simplified any further */
+			_NODISCARD std::vector <mesh_type> operator()(mesh_type const& mesh, size_t levels, double ratio = 0.5) const
+			{
+				std::vector <mesh_type> chain;
+				chain.reserve(levels);
+
+				if (levels != 0)
+					chain.push_back(mesh);
+
+				while (chain.size() < levels)
+				{
+					auto config = myConfig;
+					config.targetTriangles = static_cast <size_t>(static_cast <double>(chain.back().size() / 3) * ratio);
+					config.maxError		   = std::numeric_limits <double>::infinity();
+
+					auto level = MeshSimplifier{ config }(chain.back());
+
+					if (level.size() >= chain.back().size())
+						break;
+
+					chain.push_back(std::move(level));
+				}
+
+				return chain;
+			}
+
+		private:
+			/* the positions are welded on a grid relative to the radius, so the rounding of the generated ones is no seam */
+			_NODISCARD std::vector <uint8_t> make_seams (std::vector <glm::dvec3> const& positions, double radius) const
+			{
+				std::vector <uint8_t> locked (positions.size());
+
+				if (!myConfig.preserveSeams || radius <= 0.0)
+					return locked;
+
+				using key_type = std::array <int64_t, 3>;
+
+				std::vector <std::pair <key_type, uint32_t>> keys (positions.size());
+
+				for (uint32_t i = 0; i < positions.size(); ++i)
+				{
+					auto const cell = glm::round(positions[i] / (radius * weld_tolerance));
+					keys[i] = { key_type{ static_cast <int64_t>(cell.x), static_cast <int64_t>(cell.y), static_cast <int64_t>(cell.z) }, i };
+				}
+
+				std::sort(std::execution::par, keys.begin(), keys.end());
+
+				/* the mesh keeps one vertex per position and texcoord, so the equal positions are the seams */
+				for (size_t i = 1; i < keys.size(); ++i)
+					if (keys[i - 1].first == keys[i].first)
+						locked[keys[i - 1].second] = locked[keys[i].second] = 1;
+
+				return locked;
+			}
+
+			/* the triangles are sorted along the longest axis of the mesh and cut into slabs of equal counts */
+			_NODISCARD static std::vector <triangle_type> simplify_chunks (
+				std::vector <glm::dvec3> const& positions,
+				std::vector <uint8_t> const&	locked,
+				std::vector <triangle_type>		triangles,
+				size_t chunks,
+				size_t target,
+				double error
+			) {
+				auto min = glm::dvec3{ std::numeric_limits <double>::max() };
+				auto max = glm::dvec3{ std::numeric_limits <double>::lowest() };
+
+				for (auto const& position : positions) {
+					min = glm::min(min, position);
+					max = glm::max(max, position);
+				}
+
+				auto const extent = max - min;
+				auto const axis	  = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+
+				/* the centroids are taken once instead of by every comparison */
+				std::vector <std::pair <double, uint32_t>> keys (triangles.size());
+
+				for (uint32_t t = 0; t < triangles.size(); ++t)
+				{
+					auto const& triangle = triangles[t];
+					keys[t] = { positions[triangle[0]][axis] + positions[triangle[1]][axis] + positions[triangle[2]][axis], t };
+				}
+
+				std::sort(std::execution::par, keys.begin(), keys.end());
+
+				std::vector <triangle_type> sorted (triangles.size());
+
+				for (size_t t = 0; t < keys.size(); ++t)
+					sorted[t] = triangles[keys[t].second];
+
+				triangles = std::move(sorted);
+
+				auto const chunk_of = [&] (size_t t) noexcept {
+					return static_cast <uint32_t>(t * chunks / triangles.size());
+				};
+
+				std::vector <uint32_t> owners (positions.size(), unowned);
+
+				for (size_t t = 0; t < triangles.size(); ++t)
+					for (auto const vertex : triangles[t])
+					{
+						auto& owner = owners[vertex];
+						owner = owner == unowned || owner == chunk_of(t) ? chunk_of(t) : shared;
+					}
+
+				std::vector <std::vector <triangle_type>> results (chunks);
+				std::vector <size_t>					   indices (chunks);
+				std::iota(indices.begin(), indices.end(), size_t{ 0 });
+
+				std::for_each (std::execution::par, indices.begin(), indices.end(), [&] (size_t chunk)
+				{
+					auto const first = (chunk * triangles.size() + chunks - 1) / chunks;
+					auto const last	 = ((chunk + 1) * triangles.size() + chunks - 1) / chunks;
+
+					std::unordered_map <uint32_t, uint32_t> locals;
+					std::vector <uint32_t>					 globals;
+					std::vector <glm::dvec3>				 patchPositions;
+					std::vector <uint8_t>					 patchLocked;
+					std::vector <triangle_type>				 patchTriangles;
+
+					locals.reserve(last - first);
+					patchTriangles.reserve(last - first);
+
+					for (auto t = first; t < last; ++t)
+					{
+						auto& local = patchTriangles.emplace_back();
+
+						for (size_t k = 0; k < 3; ++k)
+						{
+							auto const vertex = triangles[t][k];
+							auto const [iter, inserted] = locals.try_emplace(vertex, static_cast <uint32_t>(globals.size()));
+
+							if (inserted) {
+								globals.push_back(vertex);
+								patchPositions.push_back(positions[vertex]);
+								patchLocked.push_back(locked[vertex] || owners[vertex] == shared);
+							}
+
+							local[k] = iter->second;
+						}
+					}
+
+					auto const count = last - first;
+
+					Detail::SimplifierPatch patch { std::move(patchPositions), patchLocked, std::move(patchTriangles) };
+					patch.simplify((target * count + triangles.size() - 1) / triangles.size(), error);
+
+					auto& result = results[chunk];
+					result.reserve(patch.size());
+
+					patch.for_each_triangle([&] (triangle_type const& triangle) {
+						result.push_back({ globals[triangle[0]], globals[triangle[1]], globals[triangle[2]] });
+					});
+				});
+
+				std::vector <triangle_type> merged;
+
+				for (auto const& result : results)
+					merged.insert(merged.end(), result.begin(), result.end());
+
+				return merged;
+			}
+
+			/* the vertices are kept in the order of their first use and the unused ones are dropped */
+			_NODISCARD static mesh_type compact (std::span <_VertexTy const> vertices, Detail::SimplifierPatch const& patch)
+			{
+				std::vector <uint32_t>	remap (vertices.size(), unowned);
+				std::vector <_VertexTy> resultVertices;
+				std::vector <unsigned>	resultIndices;
+
+				resultIndices.reserve(patch.size() * 3);
+
+				patch.for_each_triangle([&] (triangle_type const& triangle) {
+					for (auto const vertex : triangle)
+					{
+						if (remap[vertex] == unowned) {
+							remap[vertex] = static_cast <uint32_t>(resultVertices.size());
+							resultVertices.push_back(vertices[vertex]);
+						}
+
+						resultIndices.push_back(remap[vertex]);
+					}
+				});
+
+				return mesh_type{ std::move(resultVertices), std::move(resultIndices) };
+			}
+
+			Configuration myConfig;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "World.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicSnapshotRing
+		{
+			using world_type	= BasicWorld <_Use2D, _ScalarTy>;
+			using snapshot_type = BasicBodySnapshot <_Use2D, _ScalarTy>;
+
+			static_assert(std::is_trivially_copyable_v <snapshot_type>, "The snapshots must be copyable by memcpy");
+
+			static void x_zero_capacity() {
+				throw std::invalid_argument("The snapshots ring must have at least one slot");
+			}
+
+			static void x_no_snapshot() {
+				throw std::out_of_range("There is no snapshot of this age");
+			}
+
+		public:
+			explicit BasicSnapshotRing (size_t capacity) :
+				mySlots (capacity)
+			{
+				if (capacity == 0)
+					x_zero_capacity();
+			}
+
+			BasicSnapshotRing(BasicSnapshotRing&&)		= delete;
+			BasicSnapshotRing(BasicSnapshotRing const&) = delete;
+
+			BasicSnapshotRing& operator=(BasicSnapshotRing&&)	   = delete;
+			BasicSnapshotRing& operator=(BasicSnapshotRing const&) = delete;
+
+			/* preallocates every slot so the captures never allocate */
+			void reserve (size_t bodiesCount)
+			{
+				for (auto& slot : mySlots)
+					slot.reserve(bodiesCount);
+			}
+
+			/* writes into the oldest slot, so the latest snapshot stays intact until the capture ends */
+			void capture (world_type const& world)
+			{
+				auto const next = (myHead + 1) % mySlots.size();
+				world.capture(mySlots[next]);
+
+				myHead = next;
+				mySize = std::min(mySize + 1, mySlots.size());
+			}
+
+			/* the age of zero is the latest snapshot */
+			void restore (world_type& world, size_t age = 0) const {
+				world.restore(get(age));
+			}
+
+			_NODISCARD std::span <snapshot_type const> get (size_t age = 0) const
+			{
+				if (age >= mySize)
+					x_no_snapshot();
+
+				return mySlots[(myHead + mySlots.size() - age) % mySlots.size()];
+			}
+
+			/* drops the snapshots newer than the age, used after a rollback to replay from it */
+			void rewind (size_t age)
+			{
+				if (age >= mySize)
+					x_no_snapshot();
+
+				myHead  = (myHead + mySlots.size() - age) % mySlots.size();
+				mySize -= age;
+			}
+
+			void clear() noexcept {
+				mySize = 0;
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return mySize;
+			}
+
+			_NODISCARD size_t capacity() const noexcept {
+				return mySlots.size();
+			}
+
+		private:
+			std::vector <std::vector <snapshot_type>> mySlots;
+
+			size_t myHead = 0;
+			size_t mySize = 0;
+		};
+
+		using SnapshotRing	 = BasicSnapshotRing <false>;
+		using SnapshotRing2D = BasicSnapshotRing <true>;
+
+		using SnapshotRingF	  = BasicSnapshotRing <false, float>;
+		using SnapshotRing2DF = BasicSnapshotRing <true,  float>;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Bounds.hxx"
+#include "Broadphase.hxx"
+
+namespace Coli
+{
+	namespace Geometry
+	{
+		/* a bounding volume hierarchy over the bounds which never move, built at once by the binned surface
+		   area heuristic, every node covers a contiguous range of the items so a whole subtree can be accepted */
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicStaticHierarchy
+		{
+			using vector_type = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using bounds_type = BasicBounds <_Use2D, _ScalarTy>;
+
+			using stack_type = Detail::GrowableStack <size_t, 64>;
+
+		public:
+			static constexpr size_t null_node = std::numeric_limits <size_t>::max();
+
+			static constexpr size_t bins_count	  = 16;
+			static constexpr size_t max_leaf_size = 4;
+
+			struct Item
+			{
+				bounds_type bounds;
+				size_t		userData = 0;
+			};
+
+		private:
+			struct Node
+			{
+				_NODISCARD bool is_leaf() const noexcept {
+					return right == null_node;
+				}
+
+				bounds_type bounds;
+
+				size_t first = 0;
+				size_t count = 0;
+
+				/* the left child follows its parent */
+				size_t right = null_node;
+			};
+
+			struct Bin
+			{
+				std::optional <bounds_type> bounds;
+				size_t count = 0;
+			};
+
+			_NODISCARD static bounds_type merged (std::optional <bounds_type> const& lhs, bounds_type const& rhs) noexcept {
+				return lhs ? lhs->merged(rhs) : rhs;
+			}
+
+			void build_node (size_t first, size_t count)
+			{
+				auto const index = myNodes.size();
+				auto const last	 = first + count;
+
+				auto bounds	   = myItems[first].bounds;
+				auto centroids = bounds_type{ bounds.get_center(), bounds.get_center() };
+
+				for (auto i = first + 1; i < last; ++i) {
+					bounds	  = bounds.merged(myItems[i].bounds);
+					centroids = centroids.merged({ myItems[i].bounds.get_center(), myItems[i].bounds.get_center() });
+				}
+
+				myNodes.push_back({ bounds, first, count });
+
+				if (count <= max_leaf_size)
+					return;
+
+				auto const middle = split(first, count, bounds, centroids);
+
+				if (!middle)
+					return;
+
+				build_node (first, *middle - first);
+
+				myNodes[index].right = myNodes.size();
+				build_node (*middle, last - *middle);
+			}
+
+			/* returns the first item of the right half, nothing when the node is cheaper as a leaf */
+			_NODISCARD std::optional <size_t> split (size_t first, size_t count, bounds_type const& bounds, bounds_type const& centroids)
+			{
+				auto const extent = centroids.max - centroids.min;
+				auto const last	  = first + count;
+
+				glm::length_t axis = 0;
+
+				for (glm::length_t i = 1; i < vector_type::length(); ++i)
+					if (extent[i] > extent[axis])
+						axis = i;
+
+				auto const begin = myItems.begin() + first;
+				auto const end	 = myItems.begin() + last;
+
+				/* the items sharing one centroid are halved without a cost */
+				if (extent[axis] <= _ScalarTy{ 0 })
+					return first + count / 2;
+
+				auto const bin_of = [&] (Item const& item) noexcept {
+					auto const offset = (item.bounds.get_center()[axis] - centroids.min[axis]) / extent[axis];
+					return std::min(bins_count - 1, static_cast <size_t>(offset * bins_count));
+				};
+
+				std::array <Bin, bins_count> bins;
+
+				for (auto iter = begin; iter != end; ++iter) {
+					auto& bin  = bins[bin_of(*iter)];
+					bin.bounds = merged(bin.bounds, iter->bounds);
+					++bin.count;
+				}
+
+				/* the cost of the right side of every plane between the bins, then the left side sweeps over them */
+				std::array <_ScalarTy, bins_count> rightCosts {};
+				std::optional <bounds_type>		   sweep;
+				size_t							   sweepCount = 0;
+
+				for (auto i = bins_count - 1; i > 0; --i)
+				{
+					if (bins[i].bounds)
+						sweep = merged(sweep, *bins[i].bounds);
+
+					sweepCount	 += bins[i].count;
+					rightCosts[i] = sweep ? sweep->get_cost() * static_cast <_ScalarTy>(sweepCount) : _ScalarTy{ 0 };
+				}
+
+				auto   bestCost = std::numeric_limits <_ScalarTy>::max();
+				size_t bestBin	= 0;
+
+				sweep.reset();
+				sweepCount = 0;
+
+				for (size_t i = 0; i + 1 < bins_count; ++i)
+				{
+					if (bins[i].bounds)
+						sweep = merged(sweep, *bins[i].bounds);
+
+					sweepCount += bins[i].count;
+
+					if (sweepCount == 0 || sweepCount == count)
+						continue;
+
+					auto const cost = sweep->get_cost() * static_cast <_ScalarTy>(sweepCount) + rightCosts[i + 1];
+
+					if (cost < bestCost) {
+						bestCost = cost;
+						bestBin	 = i;
+					}
+				}
+
+				auto const leafCost = bounds.get_cost() * static_cast <_ScalarTy>(count);
+
+				if (bestCost >= leafCost && count <= max_leaf_size * 4)
+					return std::nullopt;
+
+				auto const middle = std::partition(begin, end, [&] (Item const& item) noexcept {
+										return bin_of(item) <= bestBin;
+									});
+
+				if (middle == begin || middle == end)
+					return first + count / 2;
+
+				return static_cast <size_t>(middle - myItems.begin());
+			}
+
+		public:
+			BasicStaticHierarchy() noexcept = default;
+
+			BasicStaticHierarchy(BasicStaticHierarchy&&)	  = delete;
+			BasicStaticHierarchy(BasicStaticHierarchy const&) = delete;
+
+			BasicStaticHierarchy& operator=(BasicStaticHierarchy&&)		 = delete;
+			BasicStaticHierarchy& operator=(BasicStaticHierarchy const&) = delete;
+
+			/* replaces the whole hierarchy, the items are reordered by the leaves */
+			void build (std::vector <Item> items)
+			{
+				myItems = std::move(items);
+				myNodes.clear();
+
+				if (myItems.empty())
+					return;
+
+				myNodes.reserve(2 * myItems.size() / max_leaf_size + 1);
+				build_node (0, myItems.size());
+			}
+
+			void clear() noexcept {
+				myItems.clear();
+				myNodes.clear();
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return myItems.size();
+			}
+
+			_NODISCARD bool empty() const noexcept {
+				return myItems.empty();
+			}
+
+			_NODISCARD size_t get_nodes_count() const noexcept {
+				return myNodes.size();
+			}
+
+			/* the test classifies the bounds of a node, the subtrees outside of it are skipped and the ones
+			   inside of it are accepted without any further test, the callback receives the user data */
+			template <class _TestTy, std::invocable <size_t> _FnTy>
+				requires (std::same_as <std::invoke_result_t <_TestTy, bounds_type const&>, Containment>)
+			void query (_TestTy&& test, _FnTy&& fn) const
+			{
+				if (myNodes.empty())
+					return;
+
+				stack_type stack;
+				stack.push(0);
+
+				while (!stack.empty())
+				{
+					auto const& node = myNodes[stack.pop()];
+
+					auto const containment = std::invoke(test, node.bounds);
+
+					if (containment == Containment::outside)
+						continue;
+
+					if (containment == Containment::inside) {
+						for (auto i = node.first; i < node.first + node.count; ++i)
+							std::invoke(fn, myItems[i].userData);
+					}
+					else if (node.is_leaf()) {
+						for (auto i = node.first; i < node.first + node.count; ++i)
+							if (std::invoke(test, myItems[i].bounds) != Containment::outside)
+								std::invoke(fn, myItems[i].userData);
+					}
+					else {
+						stack.push(node.right);
+						stack.push(static_cast <size_t>(&node - myNodes.data()) + 1);
+					}
+				}
+			}
+
+		private:
+			std::vector <Node> myNodes;
+			std::vector <Item> myItems;
+		};
+
+		using StaticHierarchy	= BasicStaticHierarchy <false>;
+		using StaticHierarchy2D = BasicStaticHierarchy <true>;
+
+		using StaticHierarchyF	 = BasicStaticHierarchy <false, float>;
+		using StaticHierarchy2DF = BasicStaticHierarchy <true,  float>;
+	}
+}
\ No newline at end of file
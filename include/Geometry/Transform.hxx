@@ -9,12 +9,13 @@ namespace Coli
 {
 	namespace Geometry
 	{
-		template <bool _Use2D>
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
 		class BasicTransform :
-			public Detail::KeepsChangeBase <BasicTransform<_Use2D>>
+			public Detail::KeepsChangeBase <BasicTransform<_Use2D, _ScalarTy>>
 		{
-			using vector_type  = glm::vec <_Use2D ? 2 : 3, double>;
-			using rotator_type = std::conditional_t <_Use2D, double, glm::dquat>;
+			using vector_type  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using rotator_type = Detail::rotator_t <_Use2D, _ScalarTy>;
+			using matrix_type  = glm::mat <4, 4, _ScalarTy>;
 
 		public:
 			BasicTransform() noexcept = default;
@@ -33,22 +34,52 @@ namespace Coli
 				return *this;
 			}
 
-			_NODISCARD glm::dmat4 get_model_matrix() const noexcept 
+			_NODISCARD matrix_type get_model_matrix() const noexcept {
+				return make_model_matrix (position, rotation, scale);
+			}
+
+			/* blends the state kept before the last physics step with the current one,
+			   the transforms without the kept state give the plain model matrix */
+			_NODISCARD matrix_type get_interpolated_model_matrix (_ScalarTy alpha) const noexcept
 			{
-				const glm::dmat4 identity { 1 };
+				if (!myPreviousState)
+					return get_model_matrix();
+
+				auto const& previous = *myPreviousState;
+
+				alpha = glm::clamp (alpha, _ScalarTy{ 0 }, _ScalarTy{ 1 });
 
 				if constexpr (_Use2D)
 				{
-					const glm::vec3 rotationAxis { 0, 0, 1 };
+					/* the angles in degrees are blended the shorter way, by their difference wrapped to [-180, 180) */
+					auto const delta = rotation - previous.rotation;
+					auto const turn	 = delta - _ScalarTy{ 360 } * glm::floor((delta + _ScalarTy{ 180 }) / _ScalarTy{ 360 });
 
-					return glm::translate (identity, { position, 0 })
-						 * glm::rotate    (identity, rotation, rotationAxis)
-						 * glm::scale     (identity, { scale, 1 });
+					return make_model_matrix (glm::mix(previous.position, position, alpha),
+											  previous.rotation + turn * alpha,
+											  glm::mix(previous.scale,	  scale,	alpha));
 				}
-				else 
-					return glm::translate (identity, position)
-						 * glm::mat4_cast (rotation)
-						 * glm::scale     (identity, scale);
+				else
+					return make_model_matrix (glm::mix	(previous.position, position, alpha),
+											  glm::slerp(previous.rotation, rotation, alpha),
+											  glm::mix	(previous.scale,	scale,	  alpha));
+			}
+
+			/* the storage is allocated only for the transforms which are actually moved by the physics */
+			void keep_previous_state()
+			{
+				if (myPreviousState)
+					*myPreviousState = { rotation, position, scale };
+				else
+					myPreviousState = std::make_unique <State>(State{ rotation, position, scale });
+			}
+
+			void forget_previous_state() noexcept {
+				myPreviousState.reset();
+			}
+
+			_NODISCARD bool has_previous_state() const noexcept {
+				return myPreviousState != nullptr;
 			}
 
 			void bind_to (std::weak_ptr <BasicTransform const> parent) noexcept {
@@ -84,10 +115,41 @@ namespace Coli
 					return scale;
 			}
 
-			friend struct nlohmann::adl_serializer <BasicTransform<_Use2D>>;
+			friend struct nlohmann::adl_serializer <BasicTransform>;
 
 		private:
+			struct State
+			{
+				rotator_type rotation;
+
+				vector_type position;
+				vector_type scale;
+			};
+
+			_NODISCARD static matrix_type make_model_matrix (
+				vector_type  const& position,
+				rotator_type const& rotation,
+				vector_type  const& scale
+			) noexcept
+			{
+				const matrix_type identity { 1 };
+
+				if constexpr (_Use2D)
+				{
+					const glm::vec <3, _ScalarTy> rotationAxis { 0, 0, 1 };
+
+					return glm::translate (identity, { position, 0 })
+						 * glm::rotate    (identity, rotation, rotationAxis)
+						 * glm::scale     (identity, { scale, 1 });
+				}
+				else 
+					return glm::translate (identity, position)
+						 * glm::mat4_cast (rotation)
+						 * glm::scale     (identity, scale);
+			}
+
 			std::weak_ptr <BasicTransform const> myParent;
+			std::unique_ptr <State> myPreviousState;
 
 		public:
 			rotator_type rotation = Detail::default_rotator <rotator_type>;
@@ -98,15 +160,18 @@ namespace Coli
 
 		using Transform   = BasicTransform <false>;
 		using Transform2D = BasicTransform <true>;
+
+		using TransformF   = BasicTransform <false, float>;
+		using Transform2DF = BasicTransform <true,  float>;
 	}
 }
 
 namespace std
 {
-	template <bool _Use2D>
-	struct hash <Coli::Geometry::BasicTransform <_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct hash <Coli::Geometry::BasicTransform <_Use2D, _ScalarTy>>
 	{
-		_NODISCARD size_t operator()(Coli::Geometry::BasicTransform <_Use2D> const& val) const noexcept 
+		_NODISCARD size_t operator()(Coli::Geometry::BasicTransform <_Use2D, _ScalarTy> const& val) const noexcept 
 		{
 			Coli::Detail::HashMixer mixer;
 			size_t hash;
@@ -122,8 +187,8 @@ namespace std
 
 namespace nlohmann
 {
-	template <bool _Use2D>
-	struct adl_serializer <Coli::Geometry::BasicTransform <_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct adl_serializer <Coli::Geometry::BasicTransform <_Use2D, _ScalarTy>>
 	{
 	private:
 		struct Keys {
@@ -133,14 +198,14 @@ namespace nlohmann
 		};
 
 	public:
-		static void to_json(json& j, Coli::Geometry::BasicTransform<_Use2D> const& val)
+		static void to_json(json& j, Coli::Geometry::BasicTransform<_Use2D, _ScalarTy> const& val)
 		{
 			j[Keys::position] = val.position;
 			j[Keys::rotation] = val.rotation;
 			j[Keys::scale]    = val.scale;
 		}
 
-		static void from_json(const json& j, Coli::Geometry::BasicTransform<_Use2D>& val)
+		static void from_json(const json& j, Coli::Geometry::BasicTransform<_Use2D, _ScalarTy>& val)
 		{
 			using Coli::Detail::Json::try_fill;
 
@@ -7,17 +7,20 @@ namespace Coli
 {
 	namespace Geometry
 	{
-		template <bool _Use2D>
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
 		struct BasicVertex 
 		{
 			_NODISCARD constexpr bool operator==(BasicVertex const&) const noexcept = default;
 
-			glm::vec<_Use2D ? 2 : 3, double> position;
-			glm::dvec2			             texcoord;
+			glm::vec<_Use2D ? 2 : 3, _ScalarTy> position;
+			glm::vec<2, _ScalarTy>			    texcoord;
 		};
 
 		using Vertex   = BasicVertex <false>;
 		using Vertex2D = BasicVertex <true>;
+
+		using VertexF	= BasicVertex <false, float>;
+		using Vertex2DF = BasicVertex <true,  float>;
 	}
 
 	namespace Detail
@@ -33,18 +36,21 @@ namespace Coli
 		class VertexTraits final
 		{
 		public:
-			using vertex_type = _VertexTy;
+			using vertex_type	= _VertexTy;
+			using position_type = decltype(_VertexTy::position);
+			using texcoord_type = decltype(_VertexTy::texcoord);
+			using scalar_type	= typename position_type::value_type;
 
 			_NODISCARD static constexpr bool is_2D() noexcept {
 				return position_length() == 2;
 			}
 
 			_NODISCARD static constexpr size_t position_length() noexcept {
-				return sizeof(_VertexTy::position) / sizeof(double);
+				return position_type::length();
 			}
 
 			_NODISCARD static constexpr size_t texcoord_length() noexcept {
-				return sizeof(_VertexTy::texcoord) / sizeof(double);
+				return texcoord_type::length();
 			}
 
 			_NODISCARD static constexpr size_t position_offset() noexcept {
@@ -60,7 +66,7 @@ namespace Coli
 			}
 
 			_NODISCARD static constexpr GLenum float_type_enum() noexcept {
-				return GL_DOUBLE;
+				return std::same_as <scalar_type, float> ? GL_FLOAT : GL_DOUBLE;
 			}
 		};
 	}
@@ -68,10 +74,10 @@ namespace Coli
 
 namespace std
 {
-	template <bool _Use2D>
-	struct hash <Coli::Geometry::BasicVertex<_Use2D>>
+	template <bool _Use2D, class _ScalarTy>
+	struct hash <Coli::Geometry::BasicVertex<_Use2D, _ScalarTy>>
 	{
-		_NODISCARD size_t operator()(Coli::Geometry::BasicVertex<_Use2D> const& val) const noexcept
+		_NODISCARD size_t operator()(Coli::Geometry::BasicVertex<_Use2D, _ScalarTy> const& val) const noexcept
 		{			
 			Coli::Detail::HashMixer mixer;
 			size_t hash;
@@ -0,0 +1,726 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Collider.hxx"
+#include "PhysicalBody.hxx"
+#include "Broadphase.hxx"
+#include "Query.hxx"
+#include "Contact.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		/* a shape placed at an explicit point, used to test the world against volumes without a transform */
+		template <class _ShapeTy>
+		class ColliderProbe final :
+			public _ShapeTy
+		{
+			using vector_type = std::remove_cvref_t <decltype(std::declval <_ShapeTy const&>().get_world_position())>;
+
+		public:
+			template <class ... _ArgTys>
+			ColliderProbe (vector_type const& center, _ArgTys&&... args) noexcept :
+				_ShapeTy (std::forward<_ArgTys>(args)...),
+				myCenter (center)
+			{}
+
+			_NODISCARD vector_type get_world_position() const noexcept final {
+				return myCenter;
+			}
+
+		private:
+			vector_type myCenter;
+		};
+	}
+
+	namespace Geometry
+	{
+		template <bool _Use2D, std::floating_point _ScalarTy = double>
+		class BasicWorld
+		{
+			using vector_type	  = glm::vec <_Use2D ? 2 : 3, _ScalarTy>;
+			using rotator_type	  = Detail::rotator_t <_Use2D, _ScalarTy>;
+			using collider_type	  = Detail::SAT::ColliderBase <_Use2D, _ScalarTy>;
+			using body_type		  = BasicPhysicalBody <_Use2D, _ScalarTy>;
+			using snapshot_type	  = BasicBodySnapshot <_Use2D, _ScalarTy>;
+			using broadphase_type = BasicBroadphase <_Use2D, _ScalarTy>;
+
+			using hit_type = BasicQueryHit <_Use2D, _ScalarTy>;
+			using ray_type = BasicRay <_Use2D, _ScalarTy>;
+
+			static void x_small_output() {
+				throw std::invalid_argument("The results span is smaller than the queries span");
+			}
+
+			static void x_invalid_layer() {
+				throw std::out_of_range("The layer index exceeds the category bits count");
+			}
+
+		public:
+			static constexpr size_t layers_count = std::numeric_limits <uint32_t>::digits;
+
+		private:
+			struct Entry
+			{
+				size_t key;
+
+				collider_type* collider = nullptr;
+				body_type*	   body		= nullptr;
+
+				Detail::StatefulBase* state = nullptr;
+
+				size_t proxy = broadphase_type::null_proxy;
+
+				/* the proxy lays in the static tree */
+				bool fixed = false;
+			};
+
+			_NODISCARD static bool is_static (Entry const& entry) noexcept {
+				return !entry.body || entry.body->get_type() == BodyType::static_body;
+			}
+
+			_NODISCARD static body_type* get_dynamic_body (Entry const& entry) noexcept {
+				return entry.body && entry.body->is_dynamic() ? entry.body : nullptr;
+			}
+
+			_NODISCARD broadphase_type& get_tree (Entry const& entry) noexcept {
+				return entry.fixed ? myStaticBroadphase : myBroadphase;
+			}
+
+			_NODISCARD Entry& get_or_make_entry (size_t key)
+			{
+				auto [iter, inserted] = myIndices.try_emplace(key, myEntries.size());
+
+				if (inserted)
+					myEntries.push_back(Entry{ key });
+
+				return myEntries[iter->second];
+			}
+
+			void erase_if_empty (size_t key) noexcept
+			{
+				auto iter = myIndices.find(key);
+
+				if (iter == myIndices.end())
+					return;
+
+				auto const index = iter->second;
+				auto&	   entry = myEntries[index];
+
+				if (entry.collider || entry.body)
+					return;
+
+				myIndices.erase(iter);
+
+				if (index + 1 != myEntries.size())
+				{
+					entry = myEntries.back();
+					myIndices[entry.key] = index;
+
+					if (entry.proxy != broadphase_type::null_proxy)
+						get_tree(entry).set_user_data(entry.proxy, index);
+				}
+
+				myEntries.pop_back();
+			}
+
+			_NODISCARD std::optional <std::pair <size_t, BasicSweepHit <_Use2D, _ScalarTy>>>
+			find_time_of_impact (size_t index, vector_type const& displacement, _ScalarTy radius) const
+			{
+				auto const& entry  = myEntries[index];
+				auto const	origin = entry.collider->get_world_position();
+				auto const	swept  = BasicBounds<_Use2D, _ScalarTy>::from_sphere(origin, radius).swept(displacement);
+
+				std::optional <std::pair <size_t, BasicSweepHit <_Use2D, _ScalarTy>>>
+				earliest;
+
+				for (auto const tree : { &myBroadphase, &myStaticBroadphase })
+				{
+					tree->query (swept, [&] (size_t proxy)
+					{
+						auto const other = tree->get_user_data(proxy);
+
+						auto const& target = *myEntries[other].collider;
+
+						if (other != index && !target.is_trigger() && can_collide(*entry.collider, target))
+						{
+							auto const hit = target.cast_sphere(origin, displacement, radius);
+
+							/* touching contacts at the start of the step are left for the discrete pass */
+							if (hit && hit->fraction > 0 && (!earliest || hit->fraction < earliest->second.fraction))
+								earliest.emplace(other, *hit);
+						}
+
+						return true;
+					});
+				}
+
+				return earliest;
+			}
+
+			void integrate (float time)
+			{
+				for (auto& entry : myEntries)
+					if (auto body = get_dynamic_body(entry))
+						body->apply_forces(time);
+
+				for (size_t i = 0; i < myEntries.size(); ++i)
+				{
+					auto& entry = myEntries[i];
+
+					if (!get_dynamic_body(entry))
+						continue;
+
+					auto const displacement = entry.body->get_displacement(time);
+					entry.body->track_transform(displacement);
+
+					if (entry.collider && !entry.collider->is_trigger() && entry.body->has_continuous_collision())
+					{
+						auto const radius = entry.collider->get_bounding_radius();
+
+						if (glm::length2(displacement) > radius * radius)
+						{
+							if (auto const impact = find_time_of_impact(i, displacement, radius))
+							{
+								auto const& [other, hit] = *impact;
+
+								auto const length   = glm::length(displacement);
+								auto const fraction = std::max(_ScalarTy{ 0 }, hit.fraction - contact_slop / length);
+
+								entry.body->apply_displacement(displacement * fraction);
+
+								BasicCollision<_Use2D, _ScalarTy> const collision { hit.normal, hit.normal, 0 };
+								myContacts.push_back(ContactPair::make(entry.key, myEntries[other].key));
+
+								if (auto otherBody = get_dynamic_body(myEntries[other]))
+									entry.body->report_collision(*otherBody, collision);
+								else
+									entry.body->report_collision(collision);
+
+								continue;
+							}
+						}
+					}
+
+					entry.body->apply_displacement(displacement);
+				}
+			}
+
+			void update_broadphase (float time)
+			{
+				for (size_t i = 0; i < myEntries.size(); ++i)
+				{
+					auto& entry = myEntries[i];
+
+					if (!entry.collider)
+						continue;
+
+					/* a body was attached, detached or changed its type since the last step */
+					if (entry.fixed != is_static(entry))
+					{
+						get_tree(entry).remove(entry.proxy);
+
+						entry.fixed = !entry.fixed;
+						entry.proxy = get_tree(entry).insert(entry.collider->get_bounds(), i);
+
+						continue;
+					}
+
+					/* static colliders are never refitted */
+					if (entry.fixed)
+						continue;
+
+					auto const body			= get_dynamic_body(entry);
+					auto const displacement = body ? body->get_displacement(time) : vector_type{ 0 };
+
+					myBroadphase.move(entry.proxy, entry.collider->get_bounds(), displacement);
+				}
+			}
+
+			void find_pairs()
+			{
+				myPairs.clear();
+
+				for (size_t i = 0; i < myEntries.size(); ++i)
+				{
+					auto const& entry = myEntries[i];
+
+					if (!entry.collider || entry.fixed)
+						continue;
+
+					auto const& bounds = myBroadphase.get_fat_bounds(entry.proxy);
+
+					myBroadphase.query (bounds, [&] (size_t proxy)
+					{
+						auto const other = myBroadphase.get_user_data(proxy);
+
+						if (other > i && can_collide(*entry.collider, *myEntries[other].collider))
+							myPairs.emplace_back(i, other);
+
+						return true;
+					});
+
+					/* static pairs are never made since only the moving entries search the static tree */
+					myStaticBroadphase.query (bounds, [&] (size_t proxy)
+					{
+						auto const other = myStaticBroadphase.get_user_data(proxy);
+
+						if (can_collide(*entry.collider, *myEntries[other].collider))
+							myPairs.emplace_back(i, other);
+
+						return true;
+					});
+				}
+			}
+
+			_NODISCARD static constexpr std::array <uint32_t, layers_count> make_layer_matrix() noexcept
+			{
+				std::array <uint32_t, layers_count> matrix;
+				matrix.fill(collider_type::all_categories);
+
+				return matrix;
+			}
+
+			_NODISCARD bool can_collide (collider_type const& first, collider_type const& second) const noexcept
+			{
+				if (!collider_type::can_interact(first, second))
+					return false;
+
+				if (!myLayerMatrixFlag)
+					return true;
+
+				for (auto bits = first.get_collision_category(); bits != 0; bits &= bits - 1)
+					if ((myLayerMatrix[std::countr_zero(bits)] & second.get_collision_category()) != 0)
+						return true;
+
+				return false;
+			}
+
+			template <class _FnTy>
+			void overlap (collider_type const& probe, QueryFilter const& filter, _FnTy& fn) const
+			{
+				bool proceed = true;
+
+				for (auto const tree : { &myBroadphase, &myStaticBroadphase })
+				{
+					tree->query (probe.get_bounds(), [&] (size_t proxy)
+					{
+						auto const& entry = myEntries[tree->get_user_data(proxy)];
+
+						if (!filter.accepts(entry.key, entry.collider->get_collision_category()) ||
+							!collider_type::overlaps(probe, *entry.collider)
+						)
+							return true;
+
+						if constexpr (std::is_void_v <std::invoke_result_t <_FnTy&, size_t>>)
+							fn (entry.key);
+						else
+							proceed = static_cast<bool>(fn (entry.key));
+
+						return proceed;
+					});
+
+					if (!proceed)
+						return;
+				}
+			}
+
+			void resolve_pairs()
+			{
+				for (auto const [first, second] : myPairs)
+				{
+					auto& left  = myEntries[first];
+					auto& right = myEntries[second];
+
+					if (left.collider->is_trigger() || right.collider->is_trigger())
+					{
+						if (collider_type::overlaps(*left.collider, *right.collider))
+							myContacts.push_back(ContactPair::make(left.key, right.key, true));
+
+						continue;
+					}
+
+					auto const collision = collider_type::find_collision(*left.collider, *right.collider);
+
+					if (!collision)
+						continue;
+
+					myContacts.push_back(ContactPair::make(left.key, right.key));
+
+					/* kinematic and static bodies act as an infinite mass */
+					auto const leftBody  = get_dynamic_body(left);
+					auto const rightBody = get_dynamic_body(right);
+
+					if (leftBody && rightBody)
+						leftBody->report_collision(*rightBody, *collision);
+
+					else if (leftBody) {
+						if (glm::dot(leftBody->get_velocity(), collision->direction) < 0)
+							leftBody->report_collision(*collision);
+					}
+					else if (rightBody) {
+						if (glm::dot(rightBody->get_velocity(), collision->direction) > 0)
+							rightBody->report_collision(*collision);
+					}
+				}
+			}
+
+			/* walks both sorted contact sets at once, the listener may attach and detach entries meanwhile */
+			void report_contacts()
+			{
+				std::ranges::sort (myContacts);
+				myContacts.erase (std::ranges::unique(myContacts).begin(), myContacts.end());
+
+				if (myListener)
+				{
+					auto current  = myContacts.begin();
+					auto previous = myPreviousContacts.begin();
+
+					while (current != myContacts.end() || previous != myPreviousContacts.end())
+					{
+						if (previous == myPreviousContacts.end() || (current != myContacts.end() && *current < *previous))
+							myListener->on_contact(ContactPhase::enter, *current++);
+
+						else if (current == myContacts.end() || *previous < *current)
+							myListener->on_contact(ContactPhase::exit, *previous++);
+
+						else {
+							myListener->on_contact(ContactPhase::stay, *current++);
+							++previous;
+						}
+					}
+				}
+
+				myPreviousContacts.swap(myContacts);
+				myContacts.clear();
+			}
+
+		public:
+			/* distance kept between a continuous body and the surface it was stopped at */
+			static constexpr _ScalarTy contact_slop = _ScalarTy(0.005);
+
+			BasicWorld() noexcept = default;
+
+			BasicWorld(BasicWorld&&)	  = delete;
+			BasicWorld(BasicWorld const&) = delete;
+
+			BasicWorld& operator=(BasicWorld&&)		 = delete;
+			BasicWorld& operator=(BasicWorld const&) = delete;
+
+			void attach (size_t key, collider_type& collider)
+			{
+				auto& entry = get_or_make_entry(key);
+
+				if (entry.proxy != broadphase_type::null_proxy)
+					get_tree(entry).remove(entry.proxy);
+
+				entry.collider = &collider;
+				entry.fixed	   = is_static(entry);
+				entry.proxy	   = get_tree(entry).insert(collider.get_bounds(), myIndices.at(key));
+			}
+
+			/* the state flags of the owner are saved into the snapshots along with the body */
+			void attach (size_t key, body_type& body, Detail::StatefulBase* state = nullptr)
+			{
+				auto& entry = get_or_make_entry(key);
+
+				entry.body	= &body;
+				entry.state = state;
+			}
+
+			void detach (size_t key, collider_type const& collider) noexcept
+			{
+				auto iter = myIndices.find(key);
+
+				if (iter == myIndices.end())
+					return;
+
+				auto& entry = myEntries[iter->second];
+
+				if (entry.collider == &collider)
+				{
+					get_tree(entry).remove(entry.proxy);
+
+					entry.collider = nullptr;
+					entry.proxy	   = broadphase_type::null_proxy;
+
+					erase_if_empty(key);
+				}
+			}
+
+			void detach (size_t key, body_type const& body) noexcept
+			{
+				auto iter = myIndices.find(key);
+
+				if (iter == myIndices.end())
+					return;
+
+				auto& entry = myEntries[iter->second];
+
+				if (entry.body == &body) {
+					entry.body	= nullptr;
+					entry.state = nullptr;
+
+					erase_if_empty(key);
+				}
+			}
+
+			/* layers are the category bit indices, all of them collide with each other by default */
+			void set_layers_collision (size_t first, size_t second, bool enabled)
+			{
+				if (first >= layers_count || second >= layers_count)
+					x_invalid_layer();
+
+				auto const firstBit  = uint32_t{ 1 } << first;
+				auto const secondBit = uint32_t{ 1 } << second;
+
+				if (enabled) {
+					myLayerMatrix[first]  |= secondBit;
+					myLayerMatrix[second] |= firstBit;
+				}
+				else {
+					myLayerMatrix[first]  &= ~secondBit;
+					myLayerMatrix[second] &= ~firstBit;
+				}
+
+				myLayerMatrixFlag = std::ranges::any_of(myLayerMatrix, [] (uint32_t row) noexcept {
+					return row != collider_type::all_categories;
+				});
+			}
+
+			_NODISCARD bool get_layers_collision (size_t first, size_t second) const
+			{
+				if (first >= layers_count || second >= layers_count)
+					x_invalid_layer();
+
+				return (myLayerMatrix[first] & (uint32_t{ 1 } << second)) != 0;
+			}
+
+			_NODISCARD bool contains (size_t key) const noexcept {
+				return myIndices.contains(key);
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return myEntries.size();
+			}
+
+			/* the storage is refilled in place and keeps its capacity between the captures */
+			void capture (std::vector <snapshot_type>& snapshot) const
+			{
+				snapshot.clear();
+
+				for (size_t i = 0; i < myEntries.size(); ++i)
+				{
+					auto const& entry = myEntries[i];
+
+					if (!entry.body)
+						continue;
+
+					auto& record = snapshot.emplace_back();
+
+					record.key	 = entry.key;
+					record.index = i;
+
+					entry.body->capture(record);
+
+					if ((record.hasStateFlags = entry.state != nullptr))
+						record.stateFlags = entry.state->get_state_flags();
+				}
+			}
+
+			/* records of the detached bodies are skipped */
+			void restore (std::span <snapshot_type const> snapshot) noexcept
+			{
+				for (auto const& record : snapshot)
+				{
+					Entry* entry = nullptr;
+
+					if (record.index < myEntries.size() && myEntries[record.index].key == record.key)
+						entry = &myEntries[record.index];
+
+					else if (auto iter = myIndices.find(record.key); iter != myIndices.end())
+						entry = &myEntries[iter->second];
+
+					if (!entry || !entry->body)
+						continue;
+
+					entry->body->restore(record);
+
+					if (record.hasStateFlags && entry->state)
+						entry->state->set_state_flags(record.stateFlags);
+				}
+			}
+
+			/* pairs which passed the broadphase during the last step */
+			_NODISCARD size_t get_pairs_count() const noexcept {
+				return myPairs.size();
+			}
+
+			_NODISCARD size_t get_contacts_count() const noexcept {
+				return myPreviousContacts.size();
+			}
+
+			void step (float time)
+			{
+				integrate (time);
+				update_broadphase (time);
+
+				find_pairs();
+				resolve_pairs();
+
+				report_contacts();
+			}
+
+			/* the listener receives enter, stay and exit events of every contact after each step */
+			void set_contact_listener (ContactListener* listener) noexcept {
+				myListener = listener;
+			}
+
+			_NODISCARD std::optional <hit_type> raycast (ray_type const& ray, QueryFilter const& filter = {}) const {
+				return sweep_sphere(ray, _ScalarTy{ 0 }, filter);
+			}
+
+			_NODISCARD std::optional <hit_type> sweep_sphere (ray_type const& ray, _ScalarTy radius, QueryFilter const& filter = {}) const
+			{
+				auto const length = glm::length(ray.direction);
+
+				if (length == 0)
+					return std::nullopt;
+
+				auto const direction = ray.direction / length;
+				std::optional <hit_type> closest;
+
+				for (auto const tree : { &myBroadphase, &myStaticBroadphase })
+				{
+					auto const maxDistance = closest ? closest->distance : ray.maxDistance;
+
+					if (maxDistance == 0)
+						break;
+
+					tree->sweep (ray.origin, direction, maxDistance, radius, [&] (size_t proxy, _ScalarTy clip)
+					{
+						auto const& entry = myEntries[tree->get_user_data(proxy)];
+
+						if (!filter.accepts(entry.key, entry.collider->get_collision_category()))
+							return _ScalarTy{ -1 };
+
+						/* keeps the cast finite for unbounded rays, nothing lays farther than the candidate bounds */
+						auto const& bounds = tree->get_fat_bounds(proxy);
+						auto const	reach  = std::min(clip, glm::length(bounds.get_center() - ray.origin) + glm::length(bounds.get_extents()) + radius);
+
+						auto const hit = entry.collider->cast_sphere(ray.origin, direction * reach, radius);
+
+						if (!hit)
+							return _ScalarTy{ -1 };
+
+						auto const distance = hit->fraction * reach;
+						auto const point	= ray.origin + direction * distance - hit->normal * radius;
+
+						closest.emplace(hit_type{ entry.key, distance, point, hit->normal });
+						return distance;
+					});
+				}
+
+				return closest;
+			}
+
+			void raycast (
+				std::span <ray_type const> rays,
+				std::span <std::optional <hit_type>> results,
+				QueryFilter const& filter = {}
+			) const
+			{
+				if (results.size() < rays.size())
+					x_small_output();
+
+				std::for_each (std::execution::par, rays.begin(), rays.end(), [&] (ray_type const& ray) {
+					results[&ray - rays.data()] = raycast(ray, filter);
+				});
+			}
+
+			void sweep_sphere (
+				std::span <ray_type const> rays,
+				_ScalarTy radius,
+				std::span <std::optional <hit_type>> results,
+				QueryFilter const& filter = {}
+			) const
+			{
+				if (results.size() < rays.size())
+					x_small_output();
+
+				std::for_each (std::execution::par, rays.begin(), rays.end(), [&] (ray_type const& ray) {
+					results[&ray - rays.data()] = sweep_sphere(ray, radius, filter);
+				});
+			}
+
+			/* the callback receives the key of every overlapping entry and may return false to stop */
+			template <std::invocable <size_t> _FnTy>
+			void overlap_sphere (vector_type const& center, _ScalarTy radius, _FnTy&& fn, QueryFilter const& filter = {}) const
+			{
+				Detail::ColliderProbe <BasicRoundCollider <_Use2D, _ScalarTy>> const probe { center, radius };
+				overlap (probe, filter, fn);
+			}
+
+			template <std::invocable <size_t> _FnTy>
+			void overlap_box (
+				vector_type const& center,
+				vector_type const& size,
+				rotator_type const& rotator,
+				_FnTy&& fn,
+				QueryFilter const& filter = {}
+			) const
+			{
+				Detail::ColliderProbe <BasicBoxCollider <_Use2D, _ScalarTy>> const probe { center, size, rotator };
+				overlap (probe, filter, fn);
+			}
+
+			_NODISCARD size_t count_sphere_overlaps (vector_type const& center, _ScalarTy radius, QueryFilter const& filter = {}) const
+			{
+				size_t count = 0;
+				overlap_sphere (center, radius, [&] (size_t) { ++count; }, filter);
+
+				return count;
+			}
+
+			void count_sphere_overlaps (
+				std::span <std::pair <vector_type, _ScalarTy> const> spheres,
+				std::span <size_t> results,
+				QueryFilter const& filter = {}
+			) const
+			{
+				if (results.size() < spheres.size())
+					x_small_output();
+
+				std::for_each (std::execution::par, spheres.begin(), spheres.end(), [&] (auto const& sphere) {
+					results[&sphere - spheres.data()] = count_sphere_overlaps(sphere.first, sphere.second, filter);
+				});
+			}
+
+		private:
+			std::vector <Entry>				   myEntries;
+			std::unordered_map <size_t, size_t> myIndices;
+
+			std::vector <std::pair <size_t, size_t>> myPairs;
+
+			std::vector <ContactPair> myContacts;
+			std::vector <ContactPair> myPreviousContacts;
+
+			ContactListener* myListener = nullptr;
+
+			broadphase_type myBroadphase;
+			broadphase_type myStaticBroadphase;
+
+			std::array <uint32_t, layers_count> myLayerMatrix = make_layer_matrix();
+			bool myLayerMatrixFlag = false;
+		};
+
+		using World   = BasicWorld <false>;
+		using World2D = BasicWorld <true>;
+
+		using WorldF   = BasicWorld <false, float>;
+		using World2DF = BasicWorld <true,  float>;
+	}
+}
\ No newline at end of file
@@ -12,7 +12,9 @@ namespace Coli
 		enum class BufferType {
 			index,
 			vertex,
-			uniform
+			uniform,
+			storage,
+			indirect
 		};
 	}
 
@@ -22,6 +24,8 @@ namespace Coli
 		requires (
 			_Type == Graphics::BufferType::vertex  ||
 			_Type == Graphics::BufferType::uniform ||
+			_Type == Graphics::BufferType::storage ||
+			_Type == Graphics::BufferType::indirect ||
 			_Type == Graphics::BufferType::index   
 		)
 		class BufferBase :
@@ -40,6 +44,12 @@ namespace Coli
 
 				case Graphics::BufferType::uniform:
 					return GL_UNIFORM_BUFFER;
+
+				case Graphics::BufferType::storage:
+					return GL_SHADER_STORAGE_BUFFER;
+
+				case Graphics::BufferType::indirect:
+					return GL_DRAW_INDIRECT_BUFFER;
 				}
 			}
 
@@ -107,6 +117,20 @@ namespace Coli
 					x_invalid_index();
 			}
 
+			_NODISCARD GLuint get_handle() const noexcept {
+				return myHandle;
+			}
+
+			/* the range binding is not cached, the next whole buffer binding of the index always takes place */
+			void bind_range (unsigned index, size_t offset, size_t size) {
+				if (index < indexed_bindings.size()) {
+					glBindBufferRange (get_type_gl(), index, myHandle, offset, size);
+					indexed_bindings[index] = 0;
+				}
+				else
+					x_invalid_index();
+			}
+
 			static void unbind (unsigned index) noexcept {
 				if (index < indexed_bindings.size())
 					glBindBufferBase(get_type_gl(), index, indexed_bindings[index] = 0);
@@ -181,6 +205,145 @@ namespace Coli
 			uint8_t* myData;
 		};
 
+		struct StreamingStats
+		{
+			size_t advances = 0;
+			size_t waits	= 0;
+
+			std::chrono::nanoseconds waitTime { 0 };
+		};
+
+		/* the persistently mapped storage split into regions, the client writes one region
+		   while the gpu reads the others and every region is guarded by the fence placed
+		   after the commands which use it, the client waits only when the gpu is that many frames behind */
+		template <BufferType _Type, size_t _Regions = 3>
+			requires (_Regions > 0)
+		class StreamBuffer final :
+			public Detail::BufferBase<_Type>
+		{
+			using base = Detail::BufferBase<_Type>;
+
+			static void x_failed_map() {
+				throw std::runtime_error("Failed to map the stream buffer");
+			}
+
+			static void x_overflow() {
+				throw std::overflow_error("the stream region overflowed");
+			}
+
+			_NODISCARD static constexpr size_t align (size_t size, size_t alignment) noexcept {
+				return alignment > 1 ? (size + alignment - 1) / alignment * alignment : size;
+			}
+
+		public:
+			/* the region size is rounded up to the alignment, so every region may be bound as a range */
+			explicit StreamBuffer (size_t regionSize, size_t alignment = 1) :
+				myRegionSize (align(regionSize, alignment))
+			{
+				constexpr GLbitfield flags = GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_MAP_WRITE_BIT;
+
+				glNamedBufferStorage (myHandle, myRegionSize * _Regions, nullptr, flags);
+				myData = reinterpret_cast<uint8_t*>(glMapNamedBufferRange(myHandle, 0, myRegionSize * _Regions, flags));
+
+				if (!myData)
+					x_failed_map();
+			}
+
+			~StreamBuffer() noexcept
+			{
+				for (auto fence : myFences)
+					if (fence)
+						glDeleteSync(fence);
+
+				glUnmapNamedBuffer(myHandle);
+			}
+
+			StreamBuffer(StreamBuffer&&)	  = delete;
+			StreamBuffer(StreamBuffer const&) = delete;
+
+			StreamBuffer& operator=(StreamBuffer&&)		 = delete;
+			StreamBuffer& operator=(StreamBuffer const&) = delete;
+
+			/* the offset is relative to the current region, the mapping is coherent so no barrier is needed */
+			void write (auto const& initData, size_t offset)
+			{
+				auto [data, size] = base::take_memory(initData);
+
+				if (size + offset > myRegionSize)
+					x_overflow();
+
+				memcpy_s(myData + get_region_offset() + offset, myRegionSize - offset, data, size);
+			}
+
+			void bind_range (unsigned index, size_t offset, size_t size) {
+				base::bind_range (index, get_region_offset() + offset, size);
+			}
+
+			/* fences the commands issued with the current region and moves to the next one */
+			void advance()
+			{
+				auto& fence = myFences[myRegion];
+
+				if (fence)
+					glDeleteSync(fence);
+
+				fence	 = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				myRegion = (myRegion + 1) % _Regions;
+
+				wait_region();
+				++myStats.advances;
+			}
+
+			_NODISCARD size_t get_region_size() const noexcept {
+				return myRegionSize;
+			}
+
+			_NODISCARD size_t get_region_offset() const noexcept {
+				return myRegion * myRegionSize;
+			}
+
+			_NODISCARD StreamingStats const& get_stats() const noexcept {
+				return myStats;
+			}
+
+		private:
+			void wait_region() noexcept
+			{
+				auto& fence = myFences[myRegion];
+
+				if (!fence)
+					return;
+
+				auto status = glClientWaitSync(fence, 0, 0);
+
+				if (status == GL_TIMEOUT_EXPIRED)
+				{
+					auto const start = std::chrono::steady_clock::now();
+
+					do status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait_timeout);
+					while (status == GL_TIMEOUT_EXPIRED);
+
+					++myStats.waits;
+					myStats.waitTime += std::chrono::steady_clock::now() - start;
+				}
+
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+
+			static constexpr GLuint64 wait_timeout = 1'000'000;
+
+			using base::myHandle;
+
+			std::array <GLsync, _Regions> myFences {};
+
+			size_t	 myRegionSize;
+			size_t	 myRegion = 0;
+			uint8_t* myData	  = nullptr;
+
+			StreamingStats myStats;
+		};
+
 		template <BufferType _Type>
 		class Storage final :
 			public Detail::BufferBase<_Type>
@@ -193,6 +356,23 @@ namespace Coli
 				glNamedBufferStorage(myHandle, size, data, 0);
 			}
 
+			/* the empty storage which is filled part by part */
+			Storage (size_t size, GLbitfield flags)
+			{
+				glNamedBufferStorage(myHandle, size, nullptr, flags | GL_DYNAMIC_STORAGE_BIT);
+			}
+
+			void write (auto const& initData, size_t offset) noexcept
+			{
+				auto [data, size] = Detail::BufferBase<_Type>::take_memory(initData);
+
+				glNamedBufferSubData(myHandle, offset, size, data);
+			}
+
+			void copy_to (Storage& other, size_t size) const noexcept {
+				glCopyNamedBufferSubData(myHandle, other.myHandle, 0, 0, size);
+			}
+
 		private:
 			using Detail::BufferBase<_Type>::myHandle;
 		};
@@ -204,5 +384,10 @@ namespace Coli
 		using VertexBuffer  = Buffer <BufferType::vertex>;
 		using IndexBuffer   = Buffer <BufferType::index>;
 		using UniformBuffer = Buffer <BufferType::uniform>;
+		using StorageBuffer = Buffer <BufferType::storage>;
+
+		using UniformStreamBuffer  = StreamBuffer <BufferType::uniform>;
+		using StorageStreamBuffer  = StreamBuffer <BufferType::storage>;
+		using IndirectStreamBuffer = StreamBuffer <BufferType::indirect>;
 	}
 }
\ No newline at end of file
@@ -17,6 +17,10 @@ namespace Coli
 					throw std::runtime_error("Failed to load GLAD");
 				}
 
+				static void x_unsupported_version() {
+					throw std::runtime_error("OpenGL 4.6 is not supported by the driver");
+				}
+
 			protected:
 				GLADContext() noexcept = default;
 
@@ -25,6 +29,9 @@ namespace Coli
 						if (!gladLoadGL())
 							x_failed_load();
 
+						if (!GLAD_GL_VERSION_4_6)
+							x_unsupported_version();
+
 						loaded = true;
 					}
 				}
@@ -36,6 +43,10 @@ namespace Coli
 				GLADContext& operator=(GLADContext&&)	   = delete;
 				GLADContext& operator=(GLADContext const&) = delete;
 
+				/* the default shaders index the instances by the base instance of the 4.6 language */
+				static constexpr int version_major = 4;
+				static constexpr int version_minor = 6;
+
 				_NODISCARD static bool is_loaded() noexcept {
 					return loaded;
 				}
@@ -5,7 +5,7 @@
 
 #include "Context.hxx"
 #include "Buffer.hxx"
-#include "VertexArray.hxx"
+#include "MeshCache.hxx"
 #include "Material.hxx"
 
 #include "../Geometry/Mesh.hxx"
@@ -29,12 +29,12 @@ namespace Coli
 				glm::mat4 model = { 1 };
 			};
 
+			/* keeps only the model on the client side, the render queue streams it
+			   to the shared uniform ring or to the instance storage every frame */
 			class ModelContext
 			{
 			public:
-				ModelContext() :
-					myBuffer (default_value)
-				{}
+				ModelContext() noexcept = default;
 
 				ModelContext(ModelContext&&)	  = delete;
 				ModelContext(ModelContext const&) = delete;
@@ -42,65 +42,50 @@ namespace Coli
 				ModelContext& operator=(ModelContext&&)		 = delete;
 				ModelContext& operator=(ModelContext const&) = delete;
 
-				template <bool _Is2D>
-				void update (Geometry::BasicTransform <_Is2D> const& transform) noexcept {
-					if (transform.has_changed())
-						myBuffer.write(static_cast<glm::mat4>(transform.get_model_matrix()), offsetof(ModelUniformBlock, model));
+				template <bool _Is2D, class _ScalarTy>
+				void update (Geometry::BasicTransform <_Is2D, _ScalarTy> const& transform) noexcept {
+					if (transform.has_changed() || myInterpolatedFlag)
+						write_model (transform.get_model_matrix(), false);
 				}
 
-				void bind() {
-					myBuffer.bind(ModelUniformBlock::binding_index);
+				/* the moving transforms are written every frame, blended between the last two physics steps */
+				template <bool _Is2D, class _ScalarTy>
+				void update (Geometry::BasicTransform <_Is2D, _ScalarTy> const& transform, float alpha) noexcept {
+					if (transform.has_previous_state())
+						write_model (transform.get_interpolated_model_matrix(static_cast<_ScalarTy>(alpha)), true);
+					else
+						update (transform);
 				}
 
-				void unbind() noexcept {
-					Graphics::UniformBuffer::unbind(ModelUniformBlock::binding_index);
+				_NODISCARD glm::mat4 const& get_model() const noexcept {
+					return myModel;
 				}
 
-			private:
-				static constexpr ModelUniformBlock default_value = {};
-
-				Graphics::UniformBuffer myBuffer;
-			};
-
-			template <Vertex _VertexTy>
-			class MeshContext
-			{
-			public:
-				MeshContext (Geometry::Mesh<_VertexTy> const& mesh) :
-					myVerticesCount (mesh.size()),
-					myVertices		(mesh.get_vertices()),
-					myIndices		(mesh.get_indices()),
-					myVAO			(myVertices)
-				{}
-
-				MeshContext(MeshContext&&)		= delete;
-				MeshContext(MeshContext const&) = delete;
-
-				MeshContext& operator=(MeshContext&&)	   = delete;
-				MeshContext& operator=(MeshContext const&) = delete;
-
-				_NODISCARD size_t get_vertices_count() const noexcept {
-					return myVerticesCount;
+				/* counts the written models, the renderer refits the static drawables whose count moved */
+				_NODISCARD size_t get_revision() const noexcept {
+					return myRevision;
 				}
 
-				void bind() {
-					myVAO.bind();
-					myVertices.bind();
-					myIndices.bind();
+				/* the translation of the last written model, the render queue sorts the draws by its depth */
+				_NODISCARD glm::vec3 get_origin() const noexcept {
+					return glm::vec3(myModel[3]);
 				}
 
-				static void unbind() noexcept {
-					Graphics::IndexStorage::unbind();
-					Graphics::VertexStorage::unbind();
-					Graphics::VertexArray<_VertexTy>::unbind();
+			private:
+				template <class _MatrixTy>
+				void write_model (_MatrixTy const& model, bool interpolated) noexcept {
+					myModel			   = static_cast<glm::mat4>(model);
+					myInterpolatedFlag = interpolated;
+
+					++myRevision;
 				}
 
-			private:
-				size_t myVerticesCount;
+				glm::mat4 myModel { 1.f };
 
-				Graphics::VertexStorage myVertices;
-				Graphics::IndexStorage  myIndices;
-				Graphics::VertexArray<_VertexTy> myVAO;
+				size_t myRevision = 0;
+
+				/* the last written matrix was blended, the exact one has to be written when the transform stops */
+				bool myInterpolatedFlag = false;
 			};
 
 			class DrawableBase 
@@ -131,18 +116,51 @@ namespace Coli
 
 	namespace Graphics
 	{
-		template <Detail::Vertex _VertexTy>
+		/* the levels of detail go from the finest to the coarsest, every level but the last one has
+		   the smallest screen size it is kept for, the screen size is the projected diameter of the
+		   bounding sphere as a part of the screen height */
+		template <Detail::Vertex _VertexTy, Detail::PackedFormat _FormatTy = DefaultVertexFormat <_VertexTy>>
 		class Drawable :
-			public Detail::MeshContext <_VertexTy>,
 			public Detail::ModelContext,
 			public Detail::DrawableBase
 		{
-			using mesh_base  = Detail::MeshContext<_VertexTy>;
-			using model_base = Detail::ModelContext;
+			using context_type = Detail::MeshContext <_VertexTy, _FormatTy>;
+
+			static void x_no_levels() {
+				throw std::invalid_argument("A drawable needs at least one level of detail");
+			}
+
+			static void x_invalid_thresholds() {
+				throw std::invalid_argument("Every level of detail but the last one needs a threshold");
+			}
 
 		public:
+			/* the first level is kept while the mesh covers a quarter of the screen, every next one down to the half of it */
+			static constexpr float default_threshold = 0.25f;
+
+			/* the part of the threshold the size has to pass it by before the level changes */
+			static constexpr float default_hysteresis = 0.1f;
+
+			/* the drawables of the same mesh share its upload */
 			Drawable (Geometry::Mesh<_VertexTy> const& mesh) :
-				mesh_base (mesh)
+				Drawable (std::span <Geometry::Mesh<_VertexTy> const>{ &mesh, 1 })
+			{}
+
+			Drawable (std::span <Geometry::Mesh<_VertexTy> const> levels)
+			{
+				if (levels.empty())
+					x_no_levels();
+
+				myLevels.reserve(levels.size());
+
+				for (auto const& mesh : levels)
+					myLevels.push_back(MeshCache<_VertexTy, _FormatTy>::acquire(mesh));
+
+				reset_thresholds();
+			}
+
+			Drawable (std::shared_ptr <context_type> mesh) :
+				myLevels { std::move(mesh) }
 			{}
 
 			Drawable(Drawable&&)	  = delete;
@@ -155,20 +173,60 @@ namespace Coli
 				myMaterial = material.lock();
 			}
 
-			void bind() {
-				mesh_base::bind();
-				model_base::bind();
-				myMaterial->bind();
+			_NODISCARD Detail::MaterialBase* get_material() const noexcept {
+				return myMaterial.get();
+			}
+
+			/* the mesh of the current level */
+			_NODISCARD context_type& get_mesh() const noexcept {
+				return *myLevels[myLevel];
 			}
 
-			void unbind() noexcept {
-				myMaterial->unbind();
-				model_base::unbind();
-				mesh_base::unbind();
+			_NODISCARD size_t get_levels_count() const noexcept {
+				return myLevels.size();
+			}
+
+			_NODISCARD size_t get_level() const noexcept {
+				return myLevel;
+			}
+
+			void set_thresholds (std::vector <float> thresholds, float hysteresis = default_hysteresis)
+			{
+				if (thresholds.size() + 1 != myLevels.size())
+					x_invalid_thresholds();
+
+				myThresholds = std::move(thresholds);
+				myHysteresis = hysteresis;
+			}
+
+			/* moves at most to the level the size belongs to, but only when it passed the threshold by the hysteresis */
+			context_type& select_level (float screenSize) noexcept
+			{
+				while (myLevel > 0 && screenSize > myThresholds[myLevel - 1] * (1.f + myHysteresis))
+					--myLevel;
+
+				while (myLevel + 1 < myLevels.size() && screenSize < myThresholds[myLevel] * (1.f - myHysteresis))
+					++myLevel;
+
+				return get_mesh();
 			}
 
 		private:
-			std::shared_ptr <Detail::MaterialBase> myMaterial;
+			void reset_thresholds()
+			{
+				myThresholds.resize(myLevels.size() - 1);
+
+				for (size_t i = 0; i < myThresholds.size(); ++i)
+					myThresholds[i] = std::ldexp(default_threshold, -static_cast <int>(i));
+			}
+
+			std::vector <std::shared_ptr <context_type>> myLevels;
+			std::shared_ptr <Detail::MaterialBase>		 myMaterial;
+
+			std::vector <float> myThresholds;
+
+			size_t myLevel		= 0;
+			float  myHysteresis = default_hysteresis;
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Buffer.hxx"
+#include "VertexArray.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		/* the place of a mesh inside the arena, in vertices and indices */
+		struct MeshRange
+		{
+			size_t baseVertex	 = 0;
+			size_t verticesCount = 0;
+			size_t firstIndex	 = 0;
+			size_t indicesCount	 = 0;
+		};
+
+		/* first fit over the free ranges, the neighbour free ranges are merged on release */
+		class RangeAllocator final
+		{
+		public:
+			RangeAllocator() noexcept = default;
+
+			_NODISCARD std::optional <size_t> allocate (size_t size)
+			{
+				if (size == 0)
+					return 0;
+
+				for (auto iter = myFree.begin(); iter != myFree.end(); ++iter)
+				{
+					auto const [offset, length] = *iter;
+
+					if (length < size)
+						continue;
+
+					myFree.erase(iter);
+
+					if (length > size)
+						myFree.emplace(offset + size, length - size);
+
+					return offset;
+				}
+
+				return std::nullopt;
+			}
+
+			void release (size_t offset, size_t size)
+			{
+				if (size == 0)
+					return;
+
+				auto next = myFree.lower_bound(offset);
+
+				if (next != myFree.end() && offset + size == next->first) {
+					size += next->second;
+					next  = myFree.erase(next);
+				}
+
+				if (next != myFree.begin())
+				{
+					auto previous = std::prev(next);
+
+					if (previous->first + previous->second == offset) {
+						previous->second += size;
+						return;
+					}
+				}
+
+				myFree.emplace(offset, size);
+			}
+
+			/* the new space is free */
+			void grow (size_t capacity)
+			{
+				if (capacity <= myCapacity)
+					return;
+
+				auto const previous = std::exchange(myCapacity, capacity);
+				release (previous, capacity - previous);
+			}
+
+			_NODISCARD size_t get_capacity() const noexcept {
+				return myCapacity;
+			}
+
+		private:
+			std::map <size_t, size_t> myFree;
+			size_t myCapacity = 0;
+		};
+	}
+
+	namespace Graphics
+	{
+		/* all the meshes of one packed vertex format share a vertex and an index storage
+		   and so one vertex array, it lives while any of its meshes is alive */
+		template <Detail::PackedFormat _FormatTy>
+		class GeometryArena final
+		{
+			using vertex_type = typename _FormatTy::vertex_type;
+
+			struct Token {};
+
+		public:
+			static constexpr size_t initial_vertices = 1 << 16;
+			static constexpr size_t initial_indices	 = 1 << 18;
+
+			explicit GeometryArena (Token) {
+				reserve (initial_vertices, initial_indices);
+			}
+
+			GeometryArena(GeometryArena&&)		= delete;
+			GeometryArena(GeometryArena const&) = delete;
+
+			GeometryArena& operator=(GeometryArena&&)	   = delete;
+			GeometryArena& operator=(GeometryArena const&) = delete;
+
+			_NODISCARD static std::shared_ptr <GeometryArena> acquire()
+			{
+				auto arena = instance.lock();
+
+				if (!arena)
+					instance = arena = std::make_shared <GeometryArena>(Token{});
+
+				return arena;
+			}
+
+			_NODISCARD Detail::MeshRange allocate (std::span <vertex_type const> vertices, std::span <unsigned const> indices)
+			{
+				auto baseVertex = myVertexRanges.allocate(vertices.size());
+				auto firstIndex = myIndexRanges.allocate(indices.size());
+
+				if (!baseVertex || !firstIndex)
+				{
+					if (baseVertex)
+						myVertexRanges.release(*baseVertex, vertices.size());
+
+					if (firstIndex)
+						myIndexRanges.release(*firstIndex, indices.size());
+
+					reserve (std::bit_ceil(myVertexRanges.get_capacity() + vertices.size()),
+							 std::bit_ceil(myIndexRanges.get_capacity()  + indices.size()));
+
+					baseVertex = myVertexRanges.allocate(vertices.size());
+					firstIndex = myIndexRanges.allocate(indices.size());
+				}
+
+				myVertices->write(vertices, *baseVertex * sizeof(vertex_type));
+				myIndices ->write(indices,	*firstIndex * sizeof(unsigned));
+
+				return { *baseVertex, vertices.size(), *firstIndex, indices.size() };
+			}
+
+			void release (Detail::MeshRange const& range)
+			{
+				myVertexRanges.release(range.baseVertex, range.verticesCount);
+				myIndexRanges .release(range.firstIndex, range.indicesCount);
+			}
+
+			void bind() {
+				myVAO->bind();
+			}
+
+			static void unbind() noexcept {
+				VertexArray<_FormatTy>::unbind();
+			}
+
+		private:
+			/* the storages are immutable, the bigger ones take over the contents of the old ones */
+			void reserve (size_t verticesCount, size_t indicesCount)
+			{
+				auto vertices = std::make_unique <VertexStorage>(verticesCount * sizeof(vertex_type), 0);
+				auto indices  = std::make_unique <IndexStorage> (indicesCount  * sizeof(unsigned),  0);
+
+				if (myVertices) {
+					myVertices->copy_to(*vertices, myVertexRanges.get_capacity() * sizeof(vertex_type));
+					myIndices ->copy_to(*indices,  myIndexRanges .get_capacity() * sizeof(unsigned));
+				}
+
+				auto vao = std::make_unique <VertexArray<_FormatTy>>(*vertices);
+				vao->attach_indices(*indices);
+
+				/* the deleted array may be the cached binding and its name may be given to another one later */
+				VertexArray<_FormatTy>::unbind();
+				myVAO.reset();
+
+				myVertices = std::move(vertices);
+				myIndices  = std::move(indices);
+				myVAO	   = std::move(vao);
+
+				myVertexRanges.grow(verticesCount);
+				myIndexRanges .grow(indicesCount);
+			}
+
+			static inline std::weak_ptr <GeometryArena> instance;
+
+			std::unique_ptr <VertexStorage>			 myVertices;
+			std::unique_ptr <IndexStorage>			 myIndices;
+			std::unique_ptr <VertexArray<_FormatTy>> myVAO;
+
+			Detail::RangeAllocator myVertexRanges;
+			Detail::RangeAllocator myIndexRanges;
+		};
+	}
+}
\ No newline at end of file
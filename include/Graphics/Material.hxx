@@ -6,6 +6,7 @@
 #include "Texture.hxx"
 #include "Shader.hxx"
 #include "Program.hxx"
+#include "ProgramCache.hxx"
 
 namespace Coli
 {
@@ -14,21 +15,14 @@ namespace Coli
 		class MaterialBase
 		{
 		protected:
+			/* the materials of the same sources share one program */
 			MaterialBase(
 				std::string_view vertexCode,
 				std::string_view fragmentCode,
 				std::optional <std::string_view> geometryCode = std::nullopt
-			) {
-				Graphics::VertexShader   vertex   { vertexCode };
-				Graphics::FragmentShader fragment { fragmentCode };
-
-				if (geometryCode) {
-					Graphics::GeometryShader geometry { fragmentCode };
-					myProgram = std::make_shared <Graphics::Program>(vertex, fragment, geometry);
-				}
-				else
-					myProgram = std::make_shared <Graphics::Program>(vertex, fragment);				
-			}
+			) :
+				myProgram (Graphics::ProgramCache::acquire(vertexCode, fragmentCode, geometryCode))
+			{}
 
 		public:
 			MaterialBase(MaterialBase&&)	  = delete;
@@ -50,8 +44,25 @@ namespace Coli
 				Graphics::Program::unbind();
 			}
 
+			/* the materials whose vertex shader reads the models from the instance storage by the instance id */
+			_NODISCARD virtual bool has_instancing() const noexcept {
+				return false;
+			}
+
+			_NODISCARD Graphics::Program& get_program() const noexcept {
+				return *myProgram;
+			}
+
+			/* only orders the draws, equal keys of different materials are harmless */
+			_NODISCARD uint16_t get_key() const noexcept {
+				return myKey;
+			}
+
 		private:
+			static inline uint16_t next_key = 0;
+
 			std::shared_ptr <Graphics::Program> myProgram;
+			uint16_t myKey = next_key++;
 		};
 	}
 
@@ -83,6 +94,10 @@ namespace Coli
 				Texture::unbind(texture_binding);
 			}
 
+			_NODISCARD bool has_instancing() const noexcept final {
+				return true;
+			}
+
 		private:
 			static constexpr unsigned texture_binding = 0;
 
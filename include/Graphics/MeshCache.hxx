@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "MeshContext.hxx"
+
+namespace Coli
+{
+	namespace Graphics
+	{
+		/* the uploaded meshes shared by all their drawables, a mesh is keyed by its content
+		   or by the name of its asset and released together with its last user */
+		template <Detail::Vertex _VertexTy, Detail::PackedFormat _FormatTy = DefaultVertexFormat <_VertexTy>>
+		class MeshCache final
+		{
+			using context_type = Detail::MeshContext <_VertexTy, _FormatTy>;
+
+			struct Entry
+			{
+				std::weak_ptr <context_type> context;
+
+				size_t verticesCount;
+				size_t indicesCount;
+			};
+
+		public:
+			MeshCache() = delete;
+
+			_NODISCARD static std::shared_ptr <context_type> acquire (Geometry::Mesh <_VertexTy> const& mesh) {
+				return acquire(content_prefix, std::hash<Geometry::Mesh <_VertexTy>>{}(mesh), mesh);
+			}
+
+			/* the mesh is loaded only when no drawable holds it */
+			template <std::invocable <> _LoaderTy>
+				requires (std::convertible_to <std::invoke_result_t <_LoaderTy>, Geometry::Mesh <_VertexTy>>)
+			_NODISCARD static std::shared_ptr <context_type> acquire (std::string_view name, _LoaderTy&& load)
+			{
+				auto const key = std::hash<std::string_view>{}(name);
+
+				if (auto context = find(name_prefix, key))
+					return context;
+
+				Geometry::Mesh <_VertexTy> const mesh = std::invoke(std::forward<_LoaderTy>(load));
+				return acquire(name_prefix, key, mesh);
+			}
+
+			_NODISCARD static size_t size() noexcept {
+				return entries.size();
+			}
+
+		private:
+			/* the content and the name keys never meet */
+			static constexpr size_t content_prefix = 0;
+			static constexpr size_t name_prefix	   = 1;
+
+			_NODISCARD static std::shared_ptr <context_type> find (size_t prefix, size_t key) noexcept
+			{
+				auto const iter = entries.find({ prefix, key });
+				return iter != entries.end() ? iter->second.context.lock() : nullptr;
+			}
+
+			_NODISCARD static std::shared_ptr <context_type> acquire (size_t prefix, size_t key, Geometry::Mesh <_VertexTy> const& mesh)
+			{
+				auto const verticesCount = mesh.get_vertices().size();
+				auto const indicesCount	 = mesh.get_indices().size();
+
+				auto const iter = entries.find({ prefix, key });
+
+				/* the equal counts make the content collisions even less likely, a colliding mesh is just not cached */
+				if (iter != entries.end())
+				{
+					auto const& entry	= iter->second;
+					auto const	context = entry.context.lock();
+
+					if (context && (prefix == name_prefix || (entry.verticesCount == verticesCount && entry.indicesCount == indicesCount)))
+						return context;
+
+					if (context)
+						return std::make_shared <context_type>(mesh);
+				}
+
+				std::shared_ptr <context_type> context { new context_type(mesh), [prefix, key] (context_type* ptr) noexcept
+				{
+					auto const iter = entries.find({ prefix, key });
+
+					if (iter != entries.end() && iter->second.context.expired())
+						entries.erase(iter);
+
+					delete ptr;
+				}};
+
+				entries.insert_or_assign({ prefix, key }, Entry{ context, verticesCount, indicesCount });
+				return context;
+			}
+
+			using key_type = std::pair <size_t, size_t>;
+
+			using hasher_type = decltype([] (key_type const& key) noexcept {
+									return Detail::HashMixer{}(key.second, key.first);
+								});
+
+			static inline std::unordered_map <key_type, Entry, hasher_type> entries;
+		};
+	}
+}
\ No newline at end of file
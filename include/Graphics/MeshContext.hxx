@@ -0,0 +1,142 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "GeometryArena.hxx"
+#include "VertexFormat.hxx"
+
+#include "../Geometry/Mesh.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		inline namespace OpenGL
+		{
+			/* the untyped part of the mesh the render queue works with */
+			class MeshContextBase
+			{
+			protected:
+				MeshContextBase() noexcept :
+					myKey (next_key++)
+				{}
+
+			public:
+				virtual ~MeshContextBase() noexcept = default;
+
+				MeshContextBase(MeshContextBase&&)		= delete;
+				MeshContextBase(MeshContextBase const&) = delete;
+
+				MeshContextBase& operator=(MeshContextBase&&)	   = delete;
+				MeshContextBase& operator=(MeshContextBase const&) = delete;
+
+				virtual void bind() = 0;
+				virtual void unbind() noexcept = 0;
+
+				/* the meshes of the same arena are drawn without rebinding anything */
+				_NODISCARD virtual void const* get_arena() const noexcept = 0;
+
+				_NODISCARD size_t get_vertices_count() const noexcept {
+					return myRange.indicesCount;
+				}
+
+				_NODISCARD MeshRange const& get_range() const noexcept {
+					return myRange;
+				}
+
+				/* the quantised meshes need their positions mapped back before the model */
+				_NODISCARD std::optional <glm::mat4> const& get_decode_matrix() const noexcept {
+					return myDecodeMatrix;
+				}
+
+				/* the center in xyz and the radius in w, in the space of the mesh */
+				_NODISCARD glm::vec4 const& get_bounding_sphere() const noexcept {
+					return myBoundingSphere;
+				}
+
+				/* only orders the draws, equal keys of different meshes are harmless */
+				_NODISCARD uint16_t get_key() const noexcept {
+					return myKey;
+				}
+
+			protected:
+				void set_decode_matrix (glm::mat4 const& matrix) noexcept {
+					myDecodeMatrix.emplace(matrix);
+				}
+
+				void set_bounding_sphere (glm::vec3 const& center, float radius) noexcept {
+					myBoundingSphere = { center, radius };
+				}
+
+				MeshRange myRange;
+
+			private:
+				static inline uint16_t next_key = 0;
+
+				std::optional <glm::mat4> myDecodeMatrix;
+				glm::vec4				  myBoundingSphere { 0.f };
+
+				uint16_t myKey;
+			};
+
+			/* the mesh vertices are packed into the format on upload */
+			template <Vertex _VertexTy, PackedFormat _FormatTy = Graphics::DefaultVertexFormat <_VertexTy>>
+				requires (std::same_as <typename _FormatTy::source_type, _VertexTy>)
+			class MeshContext :
+				public MeshContextBase
+			{
+			public:
+				MeshContext (Geometry::Mesh<_VertexTy> const& mesh) :
+					myArena (Graphics::GeometryArena<_FormatTy>::acquire())
+				{
+					auto const vertices = mesh.get_vertices();
+					auto const range	= _FormatTy::make_range(vertices);
+
+					std::vector <typename _FormatTy::vertex_type> packed;
+					packed.reserve(vertices.size());
+
+					for (auto const& vertex : vertices)
+						packed.push_back(_FormatTy::pack(vertex, range));
+
+					myRange = myArena->allocate(packed, mesh.get_indices());
+
+					auto const center = mesh.get_bounds().get_center();
+
+					if constexpr (VertexTraits <_VertexTy>::is_2D())
+						set_bounding_sphere (glm::vec3(glm::vec2(center), 0.f), static_cast <float>(mesh.get_radius()));
+					else
+						set_bounding_sphere (glm::vec3(center), static_cast <float>(mesh.get_radius()));
+
+					if constexpr (_FormatTy::is_quantized())
+						set_decode_matrix(_FormatTy::make_decode_matrix(range));
+				}
+
+				~MeshContext() noexcept {
+					myArena->release(myRange);
+				}
+
+				MeshContext(MeshContext&&)		= delete;
+				MeshContext(MeshContext const&) = delete;
+
+				MeshContext& operator=(MeshContext&&)	   = delete;
+				MeshContext& operator=(MeshContext const&) = delete;
+
+				void bind() final {
+					myArena->bind();
+				}
+
+				void unbind() noexcept final {
+					Graphics::GeometryArena<_FormatTy>::unbind();
+				}
+
+				_NODISCARD void const* get_arena() const noexcept final {
+					return myArena.get();
+				}
+
+			private:
+				std::shared_ptr <Graphics::GeometryArena<_FormatTy>> myArena;
+			};
+		}
+	}
+}
\ No newline at end of file
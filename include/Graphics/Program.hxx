@@ -21,6 +21,13 @@ namespace Coli
 			}
 
 		public:
+			/* the linked program as the driver keeps it, valid only for the same driver */
+			struct Binary
+			{
+				GLenum format = 0;
+				std::vector <std::byte> data;
+			};
+
 			Program (
 				VertexShader&   vertex,
 				FragmentShader& fragment
@@ -31,6 +38,7 @@ namespace Coli
 				glAttachShader (myHandle, vertex.myHandle);
 				glAttachShader (myHandle, fragment.myHandle);
 
+				glProgramParameteri (myHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 				glLinkProgram (myHandle);
 				
 				glDetachShader (myHandle, fragment.myHandle);
@@ -55,6 +63,7 @@ namespace Coli
 				glAttachShader(myHandle, fragment.myHandle);
 				glAttachShader(myHandle, geometry.myHandle);
 
+				glProgramParameteri(myHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 				glLinkProgram(myHandle);
 
 				glDetachShader(myHandle, geometry.myHandle);
@@ -68,6 +77,23 @@ namespace Coli
 					x_failed_link();
 			}
 
+			/* a binary of another driver fails like a link, the handle is released as no destructor runs */
+			explicit Program (Binary const& binary)
+			{
+				if ((myHandle = glCreateProgram()) == 0)
+					x_failed_create();
+
+				glProgramBinary(myHandle, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+
+				GLint flag;
+				glGetProgramiv(myHandle, GL_LINK_STATUS, &flag);
+
+				if (flag == GL_FALSE) {
+					glDeleteProgram(myHandle);
+					x_failed_link();
+				}
+			}
+
 			~Program() noexcept {
 				glDeleteProgram(myHandle);
 			}
@@ -87,6 +113,32 @@ namespace Coli
 				glUseProgram (current_binding = 0);
 			}
 
+			_NODISCARD GLuint get_handle() const noexcept {
+				return myHandle;
+			}
+
+			/* nothing when the driver keeps no binaries */
+			_NODISCARD std::optional <Binary> get_binary() const
+			{
+				GLint length = 0;
+				glGetProgramiv(myHandle, GL_PROGRAM_BINARY_LENGTH, &length);
+
+				if (length <= 0)
+					return std::nullopt;
+
+				Binary	binary;
+				GLsizei written = 0;
+
+				binary.data.resize(static_cast<size_t>(length));
+				glGetProgramBinary(myHandle, length, &written, &binary.format, binary.data.data());
+
+				if (written <= 0)
+					return std::nullopt;
+
+				binary.data.resize(static_cast<size_t>(written));
+				return binary;
+			}
+
 		private:
 			static inline GLuint current_binding = 0;
 
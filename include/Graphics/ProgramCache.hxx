@@ -0,0 +1,196 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Shader.hxx"
+#include "Program.hxx"
+
+namespace Coli
+{
+	namespace Graphics
+	{
+		/* the linked programs shared by all their materials, a program is keyed by the hash of its sources
+		   and released together with its last user, once a directory is set the binaries of the linked
+		   programs are kept in it, so the next runs on the same driver skip the compilation entirely */
+		class ProgramCache final
+		{
+			using sizes_type = std::array <uint64_t, 3>;
+
+			struct Entry
+			{
+				std::weak_ptr <Program> program;
+				sizes_type sizes;
+			};
+
+			/* the file starts with it, the binary of the given size follows */
+			struct Header
+			{
+				uint64_t   key;
+				uint64_t   driver;
+				sizes_type sizes;
+				uint32_t   format;
+				uint32_t   size;
+			};
+
+		public:
+			ProgramCache() = delete;
+
+			static void set_directory (std::filesystem::path path) {
+				directory = std::move(path);
+			}
+
+			_NODISCARD static std::optional <std::filesystem::path> const& get_directory() noexcept {
+				return directory;
+			}
+
+			_NODISCARD static std::shared_ptr <Program> acquire (
+				std::string_view vertexCode,
+				std::string_view fragmentCode,
+				std::optional <std::string_view> geometryCode = std::nullopt
+			) {
+				Detail::HashMixer mixer;
+				size_t key;
+
+				key = mixer(std::hash<std::string_view>{}(vertexCode));
+				key = mixer(std::hash<std::string_view>{}(fragmentCode), key);
+				key = mixer(geometryCode ? std::hash<std::string_view>{}(*geometryCode) : 0, key);
+
+				sizes_type const sizes { vertexCode.size(), fragmentCode.size(), geometryCode ? geometryCode->size() : 0 };
+
+				auto const iter = entries.find(key);
+
+				/* the equal sizes make the collisions even less likely, a colliding program is just not cached */
+				if (iter != entries.end())
+				{
+					auto const& entry	= iter->second;
+					auto const	program = entry.program.lock();
+
+					if (program && entry.sizes == sizes)
+						return program;
+
+					if (program)
+						return link(vertexCode, fragmentCode, geometryCode);
+				}
+
+				auto program = load(key, sizes);
+
+				if (!program) {
+					program = link(vertexCode, fragmentCode, geometryCode);
+					store(key, sizes, *program);
+				}
+
+				std::shared_ptr <Program> shared { program.release(), [key] (Program* ptr) noexcept
+				{
+					auto const iter = entries.find(key);
+
+					if (iter != entries.end() && iter->second.program.expired())
+						entries.erase(iter);
+
+					delete ptr;
+				}};
+
+				entries.insert_or_assign(key, Entry{ shared, sizes });
+				return shared;
+			}
+
+			_NODISCARD static size_t size() noexcept {
+				return entries.size();
+			}
+
+		private:
+			_NODISCARD static std::unique_ptr <Program> link (
+				std::string_view vertexCode,
+				std::string_view fragmentCode,
+				std::optional <std::string_view> geometryCode
+			) {
+				VertexShader   vertex	{ vertexCode };
+				FragmentShader fragment { fragmentCode };
+
+				if (geometryCode) {
+					GeometryShader geometry { *geometryCode };
+					return std::make_unique <Program>(vertex, fragment, geometry);
+				}
+
+				return std::make_unique <Program>(vertex, fragment);
+			}
+
+			/* the binaries of another driver or version are not even tried */
+			_NODISCARD static uint64_t get_driver() noexcept
+			{
+				Detail::HashMixer mixer;
+				size_t hash = 0;
+
+				for (auto const name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+					if (auto const string = glGetString(name))
+						hash = mixer(std::hash<std::string_view>{}(reinterpret_cast<char const*>(string)), hash);
+
+				return hash;
+			}
+
+			_NODISCARD static std::filesystem::path make_path (uint64_t key) {
+				return *directory / (std::to_string(key) + ".bin");
+			}
+
+			/* any file which does not fit is left to be overwritten by the next store */
+			_NODISCARD static std::unique_ptr <Program> load (uint64_t key, sizes_type const& sizes)
+			{
+				if (!directory)
+					return nullptr;
+
+				std::ifstream file (make_path(key), std::ios::binary);
+
+				Header header;
+
+				if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+					return nullptr;
+
+				if (header.key != key || header.sizes != sizes || header.driver != get_driver())
+					return nullptr;
+
+				Program::Binary binary;
+
+				binary.format = header.format;
+				binary.data.resize(header.size);
+
+				if (!file.read(reinterpret_cast<char*>(binary.data.data()), header.size))
+					return nullptr;
+
+				try {
+					return std::make_unique <Program>(binary);
+				}
+				catch (std::runtime_error const&) {
+					return nullptr;
+				}
+			}
+
+			/* the cache only saves time, so the failures to write it are ignored */
+			static void store (uint64_t key, sizes_type const& sizes, Program const& program)
+			{
+				if (!directory)
+					return;
+
+				auto const binary = program.get_binary();
+
+				if (!binary)
+					return;
+
+				std::ofstream file (make_path(key), std::ios::binary | std::ios::trunc);
+
+				Header const header {
+					key,
+					get_driver(),
+					sizes,
+					static_cast<uint32_t>(binary->format),
+					static_cast<uint32_t>(binary->data.size())
+				};
+
+				file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+				file.write(reinterpret_cast<char const*>(binary->data.data()), static_cast<std::streamsize>(binary->data.size()));
+			}
+
+			static inline std::unordered_map <size_t, Entry>	  entries;
+			static inline std::optional <std::filesystem::path> directory;
+		};
+	}
+}
\ No newline at end of file
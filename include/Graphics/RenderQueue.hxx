@@ -0,0 +1,413 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Drawable.hxx"
+#include "Material.hxx"
+#include "UniformRing.hxx"
+
+#include "../Geometry/Frustum.hxx"
+#include "../Geometry/OcclusionBuffer.hxx"
+
+namespace Coli
+{
+	namespace Detail
+	{
+		/* the layout is given by glMultiDrawElementsIndirect */
+		struct DrawElementsIndirectCommand
+		{
+			GLuint count;
+			GLuint instanceCount;
+			GLuint firstIndex;
+			GLint  baseVertex;
+			GLuint baseInstance;
+		};
+	}
+
+	namespace Graphics
+	{
+		/* the counters of the last executed queue */
+		struct RenderStats
+		{
+			size_t packets		  = 0;
+			size_t drawCalls	  = 0;
+			size_t instancedDraws = 0;
+			size_t multiDraws	  = 0;
+			size_t programChanges = 0;
+			size_t textureChanges = 0;
+			size_t meshChanges	  = 0;
+			size_t modelChanges	  = 0;
+
+			/* the packets outside of the frustum and hidden behind the occluders, the other counters cover only the visible ones */
+			size_t culled	= 0;
+			size_t occluded = 0;
+
+			/* how many times the client waited for the gpu to release a stream region */
+			size_t streamWaits = 0;
+
+			_NODISCARD size_t get_state_changes() const noexcept {
+				return programChanges + textureChanges + meshChanges + modelChanges;
+			}
+		};
+
+		struct DrawPacket
+		{
+			uint64_t key;
+
+			Detail::MeshContextBase* mesh;
+			Detail::ModelContext*	 model;
+			Detail::MaterialBase*	 material;
+		};
+
+		/* collects the draws of a frame and executes them in the order of their keys,
+		   only the state which differs from the previous packet is bound, the neighbour
+		   packets sharing the mesh and an instancing material are drawn as instances
+		   and the instanced batches sharing the material and the arena by one multi draw */
+		class RenderQueue final
+		{
+		public:
+			/* the key from the most significant bits: layer, program, material, mesh and depth */
+			_NODISCARD static uint64_t make_key (
+				size_t	 layer,
+				GLuint	 program,
+				uint16_t material,
+				uint16_t mesh,
+				float	 depth
+			) noexcept
+			{
+				/* the bits of a non negative float keep its order */
+				auto const depthBits = std::bit_cast <uint32_t>(std::max(depth, 0.f)) >> 16;
+
+				return static_cast <uint64_t>(std::min <size_t>(layer, layer_mask)) << layer_shift
+					 | static_cast <uint64_t>(program  & program_mask)  << program_shift
+					 | static_cast <uint64_t>(material & material_mask) << material_shift
+					 | static_cast <uint64_t>(mesh) << mesh_shift
+					 | static_cast <uint64_t>(depthBits);
+			}
+
+			/* the sphere of the mesh moved by the model and grown by its largest scale */
+			_NODISCARD static glm::vec4 get_bounding_sphere (Detail::MeshContextBase const& mesh, Detail::ModelContext const& model) noexcept
+			{
+				auto const& matrix = model.get_model();
+				auto const& sphere = mesh.get_bounding_sphere();
+
+				auto const scale = std::max({ glm::length(glm::vec3(matrix[0])),
+											  glm::length(glm::vec3(matrix[1])),
+											  glm::length(glm::vec3(matrix[2])) });
+
+				return { glm::vec3(matrix * glm::vec4(glm::vec3(sphere), 1.f)), sphere.w * scale };
+			}
+
+			_NODISCARD static Geometry::BoundsF get_bounding_bounds (Detail::MeshContextBase const& mesh, Detail::ModelContext const& model) noexcept
+			{
+				auto const sphere = get_bounding_sphere(mesh, model);
+				return Geometry::BoundsF::from_sphere(glm::vec3(sphere), sphere.w);
+			}
+
+			void submit (DrawPacket const& packet) {
+				myPackets.push_back(packet);
+			}
+
+			_NODISCARD size_t size() const noexcept {
+				return myPackets.size();
+			}
+
+			_NODISCARD bool empty() const noexcept {
+				return myPackets.empty();
+			}
+
+			void clear() noexcept {
+				myPackets.clear();
+
+				myCulled   = 0;
+				myOccluded = 0;
+			}
+
+			/* drops the packets whose bounding spheres are outside of the frustum, the spheres are tested in batches */
+			void cull (Geometry::Frustum const& frustum)
+			{
+				mySpheres.clear();
+				mySpheres.reserve(myPackets.size());
+
+				for (auto const& packet : myPackets)
+					mySpheres.push_back(get_bounding_sphere(*packet.mesh, *packet.model));
+
+				myVisibility.resize(myPackets.size());
+
+				if (frustum.cull(mySpheres, myVisibility) != myPackets.size())
+					myCulled += remove_hidden();
+			}
+
+			/* drops the packets hidden behind the occluders, after the frustum so only the visible ones are projected */
+			void cull (Geometry::OcclusionBuffer const& occlusion, glm::mat4 const& viewProjection)
+			{
+				myVisibility.resize(myPackets.size());
+
+				for (size_t i = 0; i < myPackets.size(); ++i)
+					myVisibility[i] = !occlusion.is_occluded(get_bounding_bounds(*myPackets[i].mesh, *myPackets[i].model), viewProjection);
+
+				myOccluded += remove_hidden();
+			}
+
+			/* sorts and draws the packets, then leaves the queue empty for the next frame */
+			_NODISCARD RenderStats execute()
+			{
+				RenderStats stats;
+				stats.culled   = std::exchange(myCulled, 0);
+				stats.occluded = std::exchange(myOccluded, 0);
+
+				if (myPackets.empty())
+					return stats;
+
+				std::ranges::sort (myPackets, {}, &DrawPacket::key);
+
+				make_batches();
+				upload_batches();
+
+				Program*				 program  = nullptr;
+				Detail::MaterialBase*	 material = nullptr;
+				Detail::MeshContextBase* mesh	  = nullptr;
+
+				if (!myInstances.empty()) {
+					myInstanceBuffer->bind_range (instance_binding, 0, myInstances.size() * sizeof(glm::mat4));
+					myCommandBuffer ->bind();
+				}
+
+				for (size_t i = 0; i < myBatches.size(); )
+				{
+					auto const& batch  = myBatches[i];
+					auto const& packet = myPackets[batch.first];
+
+					if (packet.material != material)
+					{
+						if (&packet.material->get_program() != program) {
+							program = &packet.material->get_program();
+							program->bind();
+
+							++stats.programChanges;
+						}
+
+						material = packet.material;
+						material->bind_textures();
+
+						++stats.textureChanges;
+					}
+
+					if (!mesh || packet.mesh->get_arena() != mesh->get_arena()) {
+						packet.mesh->bind();
+						++stats.meshChanges;
+					}
+
+					mesh = packet.mesh;
+
+					auto const& command = myCommands[i];
+					auto const	indices = reinterpret_cast<void const*>(command.firstIndex * sizeof(GLuint));
+
+					++stats.drawCalls;
+
+					if (!batch.instanced)
+					{
+						auto const offset = myUniformRing.push(Detail::ModelUniformBlock{ get_model(packet) });
+						myUniformRing.bind_range (Detail::ModelUniformBlock::binding_index, offset, sizeof(Detail::ModelUniformBlock));
+
+						glDrawElementsBaseVertex (GL_TRIANGLES, command.count, GL_UNSIGNED_INT, indices, command.baseVertex);
+
+						++stats.modelChanges;
+						++i;
+
+						continue;
+					}
+
+					/* the instanced batches of one material and one arena differ only by their commands */
+					auto last = i + 1;
+
+					for (; last < myBatches.size(); ++last)
+					{
+						auto const& next = myPackets[myBatches[last].first];
+
+						if (!myBatches[last].instanced || next.material != material || next.mesh->get_arena() != mesh->get_arena())
+							break;
+					}
+
+					if (last - i == 1)
+						glDrawElementsInstancedBaseVertexBaseInstance (GL_TRIANGLES, command.count, GL_UNSIGNED_INT, indices,
+																	   command.instanceCount, command.baseVertex, command.baseInstance);
+					else {
+						auto const offset = myCommandBuffer->get_region_offset() + i * sizeof(Detail::DrawElementsIndirectCommand);
+
+						glMultiDrawElementsIndirect (GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<void const*>(offset), static_cast <GLsizei>(last - i), 0);
+						++stats.multiDraws;
+					}
+
+					stats.instancedDraws += last - i;
+					i = last;
+				}
+
+				UniformRing::unbind(Detail::ModelUniformBlock::binding_index);
+
+				if (!myInstances.empty()) {
+					StorageStreamBuffer ::unbind(instance_binding);
+					IndirectStreamBuffer::unbind();
+				}
+
+				mesh	->unbind();
+				material->unbind();
+
+				auto const waits = get_stream_waits();
+
+				myUniformRing.advance();
+
+				if (!myInstances.empty()) {
+					myInstanceBuffer->advance();
+					myCommandBuffer ->advance();
+				}
+
+				stats.streamWaits = get_stream_waits() - waits;
+
+				stats.packets = myPackets.size();
+				myPackets.clear();
+
+				return stats;
+			}
+
+		private:
+			struct Batch
+			{
+				size_t first;
+				size_t count;
+
+				bool instanced;
+			};
+
+			_NODISCARD static size_t get_instance_alignment() noexcept
+			{
+				static size_t const alignment = [] () noexcept
+				{
+					GLint bytes = 0;
+					glGetIntegerv (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &bytes);
+
+					return std::max <size_t>(1, static_cast <size_t>(bytes));
+				}();
+
+				return alignment;
+			}
+
+			_NODISCARD static glm::mat4 get_model (DrawPacket const& packet) noexcept
+			{
+				if (auto const& decode = packet.mesh->get_decode_matrix())
+					return packet.model->get_model() * *decode;
+
+				return packet.model->get_model();
+			}
+
+			/* keeps the packets marked as visible, returns how many were removed */
+			size_t remove_hidden() noexcept
+			{
+				size_t visible = 0;
+
+				for (size_t i = 0; i < myPackets.size(); ++i)
+					if (myVisibility[i])
+						myPackets[visible++] = myPackets[i];
+
+				auto const hidden = myPackets.size() - visible;
+				myPackets.erase(myPackets.begin() + visible, myPackets.end());
+
+				return hidden;
+			}
+
+			/* the sorted packets with the same mesh and material lay next to each other,
+			   every batch gets its command and the instanced ones their part of the instance storage */
+			void make_batches()
+			{
+				myBatches.clear();
+				myCommands.clear();
+				myInstances.clear();
+
+				for (size_t i = 0; i < myPackets.size(); )
+				{
+					auto const& packet = myPackets[i];
+					auto const& range  = packet.mesh->get_range();
+
+					auto last = i + 1;
+
+					if (packet.material->has_instancing())
+						for (; last < myPackets.size() && myPackets[last].mesh	   == packet.mesh
+													   && myPackets[last].material == packet.material; ++last);
+
+					myBatches.push_back({ i, last - i, packet.material->has_instancing() });
+
+					myCommands.push_back({
+						static_cast <GLuint>(range.indicesCount),
+						static_cast <GLuint>(last - i),
+						static_cast <GLuint>(range.firstIndex),
+						static_cast <GLint> (range.baseVertex),
+						static_cast <GLuint>(myInstances.size())
+					});
+
+					if (myBatches.back().instanced)
+						for (; i < last; ++i)
+							myInstances.push_back(get_model(myPackets[i]));
+					else
+						i = last;
+				}
+			}
+
+			/* the storages are immutable, the bigger ones replace them */
+			void upload_batches()
+			{
+				if (myInstances.empty())
+					return;
+
+				auto const instanceBytes = myInstances.size() * sizeof(glm::mat4);
+				auto const commandBytes	 = myCommands .size() * sizeof(Detail::DrawElementsIndirectCommand);
+
+				if (!myInstanceBuffer || instanceBytes > myInstanceBuffer->get_region_size())
+					myInstanceBuffer = std::make_unique <StorageStreamBuffer>(std::bit_ceil(instanceBytes), get_instance_alignment());
+
+				if (!myCommandBuffer || commandBytes > myCommandBuffer->get_region_size())
+					myCommandBuffer = std::make_unique <IndirectStreamBuffer>(std::bit_ceil(commandBytes));
+
+				myInstanceBuffer->write(myInstances, 0);
+				myCommandBuffer ->write(myCommands,	 0);
+			}
+
+			_NODISCARD size_t get_stream_waits() const noexcept
+			{
+				auto waits = myUniformRing.get_stats().waits;
+
+				if (myInstanceBuffer)
+					waits += myInstanceBuffer->get_stats().waits;
+
+				return waits;
+			}
+
+			static constexpr unsigned instance_binding = 2;
+
+			static constexpr uint64_t layer_mask	= 0xff;
+			static constexpr uint64_t program_mask	= 0xfff;
+			static constexpr uint64_t material_mask = 0xfff;
+
+			static constexpr unsigned layer_shift	 = 56;
+			static constexpr unsigned program_shift	 = 44;
+			static constexpr unsigned material_shift = 32;
+			static constexpr unsigned mesh_shift	 = 16;
+
+			std::vector <DrawPacket> myPackets;
+			std::vector <Batch>		 myBatches;
+
+			std::vector <Detail::DrawElementsIndirectCommand> myCommands;
+			std::vector <glm::mat4>	 myInstances;
+
+			std::vector <glm::vec4> mySpheres;
+			std::vector <uint8_t>	myVisibility;
+			size_t					myCulled   = 0;
+			size_t					myOccluded = 0;
+
+			UniformRing myUniformRing;
+
+			std::unique_ptr <StorageStreamBuffer>  myInstanceBuffer;
+			std::unique_ptr <IndirectStreamBuffer> myCommandBuffer;
+		};
+	}
+}
\ No newline at end of file
@@ -5,8 +5,11 @@
 
 #include "Context.hxx"
 #include "Drawable.hxx"
+#include "RenderQueue.hxx"
 
 #include "../Visual/Camera.hxx"
+#include "../Geometry/StaticHierarchy.hxx"
+#include "../Geometry/OcclusionBuffer.hxx"
 
 namespace Coli
 {
@@ -51,6 +54,41 @@ namespace Coli
 					else if (viewChanged)
 						myBuffer.write (camera.get_view_matrix(), 
 									    offsetof(CameraUniformBlock, view));
+
+					if (viewChanged)
+						myView = camera.get_view_matrix();
+
+					if (projChanged)
+						myProjection = camera.get_projection_matrix();
+
+					if (projChanged || viewChanged) {
+						myViewProjection = myProjection * myView;
+						myFrustum.emplace(myViewProjection);
+					}
+				}
+
+				/* the distance from the camera along its view direction */
+				_NODISCARD float get_depth (glm::vec3 const& point) const noexcept {
+					return -(myView * glm::vec4(point, 1.f)).z;
+				}
+
+				/* the projected diameter of the sphere as a part of the screen height, the whole screen before the first camera */
+				_NODISCARD float get_screen_size (glm::vec4 const& sphere) const noexcept
+				{
+					if (!myFrustum)
+						return 1.f;
+
+					auto const w = (myViewProjection * glm::vec4(glm::vec3(sphere), 1.f)).w;
+					return sphere.w * myProjection[1][1] / std::max(w, std::numeric_limits <float>::epsilon());
+				}
+
+				_NODISCARD glm::mat4 const& get_view_projection() const noexcept {
+					return myViewProjection;
+				}
+
+				/* nothing is culled before the first camera */
+				_NODISCARD std::optional <Geometry::Frustum> const& get_frustum() const noexcept {
+					return myFrustum;
 				}
 
 				void bind() {
@@ -65,6 +103,11 @@ namespace Coli
 				static constexpr CameraUniformBlock default_value = {};
 
 				Graphics::UniformBuffer myBuffer;
+				glm::mat4				myView			 { 1.f };
+				glm::mat4				myProjection	 { 1.f };
+				glm::mat4				myViewProjection { 1.f };
+
+				std::optional <Geometry::Frustum> myFrustum;
 			};
 		}
 	}
@@ -83,17 +126,257 @@ namespace Coli
 			Renderer& operator=(Renderer&&)		 = delete;
 			Renderer& operator=(Renderer const&) = delete;
 
-			template <class _VertexTy>
-			void draw (Drawable<_VertexTy>& drawable)
+			static constexpr size_t null_static = std::numeric_limits <size_t>::max();
+
+			/* the drawable is only queued, the queue is executed once the whole frame is submitted */
+			template <class _VertexTy, class _FormatTy>
+			void submit (Drawable<_VertexTy, _FormatTy>& drawable, size_t layer = 0)
+			{
+				if (auto const material = drawable.get_material())
+					myQueue.submit(make_packet(select_level(drawable), drawable, *material, layer));
+			}
+
+			/* the static drawable is kept in the hierarchy and culled by its subtrees, it has to be submitted
+			   every frame it is rendered but only the first submission which returns its handle adds it,
+			   a static drawable which is moved anyway rebuilds the hierarchy */
+			template <class _VertexTy, class _FormatTy>
+			_NODISCARD size_t submit_static (Drawable<_VertexTy, _FormatTy>& drawable, size_t handle, size_t layer = 0)
+			{
+				if (handle == null_static)
+				{
+					if (!myFreeStatics.empty()) {
+						handle = myFreeStatics.back();
+						myFreeStatics.pop_back();
+					}
+					else {
+						handle = myStatics.size();
+						myStatics.emplace_back();
+					}
+
+					myStatics[handle] = { &drawable.get_mesh(), &drawable };
+					hasStaticsChanged = true;
+				}
+
+				auto& entry = myStatics[handle];
+
+				if (entry.revision != drawable.get_revision()) {
+					entry.revision	  = drawable.get_revision();
+					hasStaticsChanged = true;
+				}
+
+				entry.mesh	   = &select_level(drawable);
+				entry.material = drawable.get_material();
+				entry.layer	   = layer;
+				entry.frame	   = myFrame;
+
+				++myStaticSubmits;
+				return handle;
+			}
+
+			/* the occlusion pass rasterises the submitted occluders into a small depth buffer on the client
+			   and drops the drawables hidden behind them, it pays off only when they hide much of the scene */
+			void set_occlusion (bool enabled)
+			{
+				if (!enabled)
+					myOcclusionBuffer.reset();
+
+				else if (!myOcclusionBuffer)
+					myOcclusionBuffer = std::make_unique <Geometry::OcclusionBuffer>();
+			}
+
+			_NODISCARD bool has_occlusion() const noexcept {
+				return myOcclusionBuffer != nullptr;
+			}
+
+			/* the occluder is rasterised only in the frame it is submitted */
+			void submit_occluder (Geometry::Occluder const& occluder, Detail::ModelContext const& model)
+			{
+				if (myOcclusionBuffer)
+					myOccluders.push_back({ &occluder, model.get_model() });
+			}
+
+			void release_static (size_t handle)
+			{
+				if (handle >= myStatics.size() || !myStatics[handle].mesh)
+					return;
+
+				myStatics[handle] = {};
+				myFreeStatics.push_back(handle);
+
+				hasStaticsChanged = true;
+			}
+
+			void flush()
+			{
+				auto const& frustum = Detail::CameraContext::get_frustum();
+
+				/* the culling happens before any state is touched */
+				if (frustum)
+					myQueue.cull(*frustum);
+
+				auto const occlusion = rasterize_occluders();
+
+				if (occlusion)
+					myQueue.cull(*occlusion, Detail::CameraContext::get_view_projection());
+
+				auto const [culled, occluded] = submit_statics(frustum, occlusion);
+
+				if (!myQueue.empty()) {
+					Detail::CameraContext::bind();
+					myStats = myQueue.execute();
+					Detail::CameraContext::unbind();
+				}
+				else
+					myStats = myQueue.execute();
+
+				myStats.culled	 += culled;
+				myStats.occluded += occluded;
+
+				myStaticSubmits = 0;
+				++myFrame;
+			}
+
+			_NODISCARD RenderStats const& get_stats() const noexcept {
+				return myStats;
+			}
+
+		private:
+			struct StaticEntry
 			{
-				Detail::CameraContext::bind();
-				drawable.bind();
+				Detail::MeshContextBase* mesh  = nullptr;
+				Detail::ModelContext*	 model = nullptr;
+
+				Detail::MaterialBase* material = nullptr;
+
+				size_t layer = 0;
+
+				/* the revision of the model the hierarchy was built with */
+				size_t revision = 0;
+
+				/* the entries not submitted in the current frame are not drawn */
+				size_t frame = null_static;
+			};
+
+			template <class _VertexTy, class _FormatTy>
+			_NODISCARD Detail::MeshContextBase& select_level (Drawable<_VertexTy, _FormatTy>& drawable) const noexcept
+			{
+				if (drawable.get_levels_count() == 1)
+					return drawable.get_mesh();
+
+				auto const sphere = RenderQueue::get_bounding_sphere(drawable.get_mesh(), drawable);
+				return drawable.select_level(Detail::CameraContext::get_screen_size(sphere));
+			}
+
+			_NODISCARD DrawPacket make_packet (
+				Detail::MeshContextBase& mesh,
+				Detail::ModelContext&	 model,
+				Detail::MaterialBase&	 material,
+				size_t layer
+			) const noexcept
+			{
+				auto const key = RenderQueue::make_key (
+					layer,
+					material.get_program().get_handle(),
+					material.get_key(),
+					mesh.get_key(),
+					Detail::CameraContext::get_depth(model.get_origin())
+				);
+
+				return { key, &mesh, &model, &material };
+			}
+
+			/* returns nothing when there is no camera or no occluder */
+			_NODISCARD Geometry::OcclusionBuffer const* rasterize_occluders()
+			{
+				if (!myOcclusionBuffer || myOccluders.empty() || !Detail::CameraContext::get_frustum()) {
+					myOccluders.clear();
+					return nullptr;
+				}
+
+				myOcclusionBuffer->clear();
+
+				for (auto const& [occluder, model] : myOccluders)
+					myOcclusionBuffer->add_occluder(*occluder, Detail::CameraContext::get_view_projection() * model);
 
-				glDrawElements (GL_TRIANGLES, drawable.get_vertices_count(), GL_UNSIGNED_INT, 0);
+				myOcclusionBuffer->rasterize();
+				myOccluders.clear();
 
-				drawable.unbind();
-				Detail::CameraContext::unbind();
+				return myOcclusionBuffer.get();
 			}
+
+			/* the hierarchy is rebuilt only when the set of the static drawables or one of their models changes,
+			   which is mostly the first frames of a scene, returns how many of the submitted ones were culled and occluded */
+			std::pair <size_t, size_t> submit_statics (std::optional <Geometry::Frustum> const& frustum, Geometry::OcclusionBuffer const* occlusion)
+			{
+				if (hasStaticsChanged)
+				{
+					std::vector <Geometry::StaticHierarchyF::Item> items;
+					items.reserve(myStatics.size());
+
+					for (size_t i = 0; i < myStatics.size(); ++i)
+					{
+						auto const& entry = myStatics[i];
+
+						if (!entry.mesh)
+							continue;
+
+						items.push_back({ RenderQueue::get_bounding_bounds(*entry.mesh, *entry.model), i });
+					}
+
+					myStaticTree.build(std::move(items));
+					hasStaticsChanged = false;
+				}
+
+				size_t visible	= 0;
+				size_t occluded = 0;
+
+				auto const submit = [this, occlusion, &visible, &occluded] (size_t handle)
+				{
+					auto const& entry = myStatics[handle];
+
+					if (entry.frame != myFrame)
+						return;
+
+					++visible;
+
+					if (occlusion && occlusion->is_occluded(RenderQueue::get_bounding_bounds(*entry.mesh, *entry.model), Detail::CameraContext::get_view_projection())) {
+						++occluded;
+						return;
+					}
+
+					if (entry.material)
+						myQueue.submit(make_packet(*entry.mesh, *entry.model, *entry.material, entry.layer));
+				};
+
+				if (frustum)
+					myStaticTree.query([&frustum] (Geometry::BoundsF const& bounds) noexcept {
+										   return frustum->classify(bounds);
+									   },
+									   submit);
+				else
+					myStaticTree.query([] (Geometry::BoundsF const&) noexcept {
+										   return Geometry::Containment::inside;
+									   },
+									   submit);
+
+				return { myStaticSubmits - visible, occluded };
+			}
+
+			RenderQueue myQueue;
+			RenderStats myStats;
+
+			std::vector <StaticEntry> myStatics;
+			std::vector <size_t>	  myFreeStatics;
+
+			Geometry::StaticHierarchyF myStaticTree;
+
+			std::unique_ptr <Geometry::OcclusionBuffer> myOcclusionBuffer;
+			std::vector <std::pair <Geometry::Occluder const*, glm::mat4>> myOccluders;
+
+			size_t myFrame		   = 0;
+			size_t myStaticSubmits = 0;
+
+			bool hasStaticsChanged = false;
 		};
 	}
 }
\ No newline at end of file
@@ -87,7 +87,7 @@ namespace Coli
 		namespace ShaderCode 
 		{
 			inline constexpr std::string_view vertex = {
-				"#version 450 core\n"
+				"#version 460 core\n"
 
 				"layout (location = 0) in vec3 inPosition;\n"
 				"layout (location = 1) in vec2 inTexcoord;\n"
@@ -98,9 +98,9 @@ namespace Coli
 					"mat4 cameraProjMat;\n"
 				"};\n"
 
-				"layout (std140, binding = 1) uniform ModelBlock\n"
+				"layout (std430, binding = 2) readonly buffer InstanceBlock\n"
 				"{\n"
-					"mat4 modelMat;\n"
+					"mat4 instanceModelMats[];\n"
 				"};\n"
 
 				"out vec2 imTexcoord;\n"
@@ -108,7 +108,7 @@ namespace Coli
 				"void main()\n"
 				"{\n"
 					"imTexcoord  = inTexcoord;\n"
-					"gl_Position = cameraProjMat * cameraViewMat * modelMat * vec4(inPosition, 1);\n"
+					"gl_Position = cameraProjMat * cameraViewMat * instanceModelMats[gl_BaseInstance + gl_InstanceID] * vec4(inPosition, 1);\n"
 				"}\n"
 			};
 
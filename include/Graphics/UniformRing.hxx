@@ -0,0 +1,89 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "Buffer.hxx"
+
+namespace Coli
+{
+	namespace Graphics
+	{
+		/* the per object blocks of a frame share one region of the uniform stream buffer,
+		   every block is copied behind the previous one and bound by its range */
+		class UniformRing final
+		{
+			static void x_too_big() {
+				throw std::overflow_error("the block does not fit the uniform ring");
+			}
+
+			_NODISCARD static size_t get_alignment() noexcept
+			{
+				GLint alignment = 0;
+				glGetIntegerv (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+				return std::max <size_t>(1, static_cast <size_t>(alignment));
+			}
+
+		public:
+			static constexpr size_t default_region_size = 4 << 20;
+
+			explicit UniformRing (size_t regionSize = default_region_size) :
+				myAlignment (get_alignment()),
+				myStream	(regionSize, myAlignment)
+			{}
+
+			UniformRing(UniformRing&&)		= delete;
+			UniformRing(UniformRing const&) = delete;
+
+			UniformRing& operator=(UniformRing&&)	   = delete;
+			UniformRing& operator=(UniformRing const&) = delete;
+
+			/* returns the offset of the copied block, a frame which fills its region moves on to the next one */
+			_NODISCARD size_t push (auto const& block)
+			{
+				auto const size = sizeof(block);
+
+				if (size > myStream.get_region_size())
+					x_too_big();
+
+				auto offset = (myHead + myAlignment - 1) / myAlignment * myAlignment;
+
+				if (offset + size > myStream.get_region_size()) {
+					myStream.advance();
+					offset = 0;
+				}
+
+				myStream.write(block, offset);
+				myHead = offset + size;
+
+				return offset;
+			}
+
+			void bind_range (unsigned index, size_t offset, size_t size) {
+				myStream.bind_range(index, offset, size);
+			}
+
+			static void unbind (unsigned index) noexcept {
+				UniformStreamBuffer::unbind(index);
+			}
+
+			/* called once the draws of the frame are issued */
+			void advance()
+			{
+				myStream.advance();
+				myHead = 0;
+			}
+
+			_NODISCARD StreamingStats const& get_stats() const noexcept {
+				return myStream.get_stats();
+			}
+
+		private:
+			size_t myAlignment;
+			size_t myHead = 0;
+
+			UniformStreamBuffer myStream;
+		};
+	}
+}
\ No newline at end of file
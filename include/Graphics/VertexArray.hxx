@@ -5,13 +5,14 @@
 
 #include "Buffer.hxx"
 
-#include "../Geometry/Vertex.hxx"
+#include "VertexFormat.hxx"
 
 namespace Coli
 {
 	namespace Graphics 
 	{
-		template <Detail::Vertex _VertexTy>
+		/* the attributes follow the packed format, so their setup is chosen at compile time */
+		template <Detail::PackedFormat _FormatTy>
 		class VertexArray final :
 			public Detail::ContextDependBase
 		{
@@ -30,23 +31,21 @@ namespace Coli
 				bind();
 				vertices.bind();
 
-				using traits_type = Detail::VertexTraits<_VertexTy>;
-
 				glVertexAttribPointer(
 					position_index,
-					traits_type::position_length(),
-					traits_type::float_type_enum(),
-					false,
-					traits_type::vertex_size(),
-					reinterpret_cast<void const*>(traits_type::position_offset())
+					_FormatTy::position_length(),
+					_FormatTy::position_type_enum(),
+					_FormatTy::is_position_normalized(),
+					_FormatTy::vertex_size(),
+					reinterpret_cast<void const*>(_FormatTy::position_offset())
 				);
 				glVertexAttribPointer(
 					texcoord_index,
-					traits_type::texcoord_length(),
-					traits_type::float_type_enum(),
-					false,
-					traits_type::vertex_size(),
-					reinterpret_cast<void const*>(traits_type::texcoord_offset())
+					_FormatTy::texcoord_length(),
+					_FormatTy::texcoord_type_enum(),
+					_FormatTy::is_texcoord_normalized(),
+					_FormatTy::vertex_size(),
+					reinterpret_cast<void const*>(_FormatTy::texcoord_offset())
 				);
 
 				glEnableVertexAttribArray(position_index);
@@ -66,6 +65,11 @@ namespace Coli
 			VertexArray& operator=(VertexArray&&)	   = delete;
 			VertexArray& operator=(VertexArray const&) = delete;
 
+			/* the element buffer is a part of the array state, binding the array binds the indices too */
+			void attach_indices (Detail::BufferBase <BufferType::index> const& indices) noexcept {
+				glVertexArrayElementBuffer(myHandle, indices.get_handle());
+			}
+
 			void bind() noexcept {
 				if (myHandle != current_binding)
 					glBindVertexArray(current_binding = myHandle);
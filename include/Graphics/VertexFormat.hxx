@@ -0,0 +1,194 @@
+#pragma once
+
+#include "../Common.hxx"
+#include "../Utility.hxx"
+
+#include "../Geometry/Vertex.hxx"
+
+namespace Coli
+{
+	namespace Graphics
+	{
+		enum class PositionEncoding {
+			float32,
+			unorm16
+		};
+
+		enum class TexcoordEncoding {
+			float32,
+			float16,
+			unorm16
+		};
+
+		/* the layout the vertices take on the gpu, the mesh vertices are packed into it on upload,
+		   the quantised positions are relative to the bounds of their mesh which the decode matrix restores */
+		template <
+			Detail::Vertex	 _VertexTy,
+			PositionEncoding _Position = PositionEncoding::float32,
+			TexcoordEncoding _Texcoord = TexcoordEncoding::float32
+		>
+		class PackedVertexFormat final
+		{
+			using traits_type = Detail::VertexTraits <_VertexTy>;
+
+			using position_component = std::conditional_t <_Position == PositionEncoding::float32, float, uint16_t>;
+			using texcoord_component = std::conditional_t <_Texcoord == TexcoordEncoding::float32, float, uint16_t>;
+
+			using vector_type = glm::vec <traits_type::position_length(), float>;
+
+			/* the odd count of the short components is padded, so the texcoords stay 4 bytes aligned */
+			static constexpr size_t position_storage = std::same_as <position_component, float> ? traits_type::position_length()
+																							  : (traits_type::position_length() + 1) / 2 * 2;
+
+		public:
+			using source_type = _VertexTy;
+
+			struct vertex_type
+			{
+				std::array <position_component, position_storage> position;
+				std::array <texcoord_component, traits_type::texcoord_length()> texcoord;
+			};
+
+			struct Range
+			{
+				vector_type bias  { 0.f };
+				vector_type scale { 1.f };
+			};
+
+			_NODISCARD static constexpr size_t position_length() noexcept {
+				return traits_type::position_length();
+			}
+
+			_NODISCARD static constexpr size_t texcoord_length() noexcept {
+				return traits_type::texcoord_length();
+			}
+
+			_NODISCARD static constexpr size_t position_offset() noexcept {
+				return offsetof(vertex_type, position);
+			}
+
+			_NODISCARD static constexpr size_t texcoord_offset() noexcept {
+				return offsetof(vertex_type, texcoord);
+			}
+
+			_NODISCARD static constexpr size_t vertex_size() noexcept {
+				return sizeof(vertex_type);
+			}
+
+			_NODISCARD static constexpr GLenum position_type_enum() noexcept {
+				return _Position == PositionEncoding::float32 ? GL_FLOAT : GL_UNSIGNED_SHORT;
+			}
+
+			_NODISCARD static constexpr GLenum texcoord_type_enum() noexcept
+			{
+				switch (_Texcoord)
+				{
+				case TexcoordEncoding::float32:
+					return GL_FLOAT;
+
+				case TexcoordEncoding::float16:
+					return GL_HALF_FLOAT;
+
+				case TexcoordEncoding::unorm16:
+					return GL_UNSIGNED_SHORT;
+				}
+			}
+
+			_NODISCARD static constexpr bool is_position_normalized() noexcept {
+				return _Position == PositionEncoding::unorm16;
+			}
+
+			_NODISCARD static constexpr bool is_texcoord_normalized() noexcept {
+				return _Texcoord == TexcoordEncoding::unorm16;
+			}
+
+			_NODISCARD static constexpr bool is_quantized() noexcept {
+				return _Position == PositionEncoding::unorm16;
+			}
+
+			_NODISCARD static Range make_range (std::span <_VertexTy const> vertices) noexcept
+			{
+				if (!is_quantized() || vertices.empty())
+					return {};
+
+				vector_type min { std::numeric_limits <float>::max() };
+				vector_type max { std::numeric_limits <float>::lowest() };
+
+				for (auto const& vertex : vertices) {
+					min = glm::min(min, vector_type(vertex.position));
+					max = glm::max(max, vector_type(vertex.position));
+				}
+
+				auto extent = max - min;
+
+				/* the flat meshes take the unit extent instead of the zero one */
+				for (glm::length_t i = 0; i < extent.length(); ++i)
+					if (extent[i] <= 0.f)
+						extent[i] = 1.f;
+
+				return { min, extent };
+			}
+
+			_NODISCARD static vertex_type pack (_VertexTy const& vertex, Range const& range) noexcept
+			{
+				vertex_type packed {};
+
+				for (glm::length_t i = 0; i < static_cast <glm::length_t>(position_length()); ++i)
+				{
+					auto const value = static_cast <float>(vertex.position[i]);
+
+					if constexpr (_Position == PositionEncoding::float32)
+						packed.position[i] = value;
+					else
+						packed.position[i] = glm::packUnorm1x16((value - range.bias[i]) / range.scale[i]);
+				}
+
+				for (glm::length_t i = 0; i < static_cast <glm::length_t>(texcoord_length()); ++i)
+				{
+					auto const value = static_cast <float>(vertex.texcoord[i]);
+
+					if constexpr (_Texcoord == TexcoordEncoding::float32)
+						packed.texcoord[i] = value;
+					else if constexpr (_Texcoord == TexcoordEncoding::float16)
+						packed.texcoord[i] = glm::packHalf1x16(value);
+					else
+						packed.texcoord[i] = glm::packUnorm1x16(value);
+				}
+
+				return packed;
+			}
+
+			/* maps the quantised positions back to the mesh space, the identity for the plain ones */
+			_NODISCARD static glm::mat4 make_decode_matrix (Range const& range) noexcept
+			{
+				const glm::mat4 identity { 1.f };
+
+				if constexpr (position_length() == 2)
+					return glm::translate (identity, glm::vec3{ range.bias, 0.f })
+						 * glm::scale	  (identity, glm::vec3{ range.scale, 1.f });
+				else
+					return glm::translate (identity, range.bias)
+						 * glm::scale	  (identity, range.scale);
+			}
+		};
+
+		template <Detail::Vertex _VertexTy>
+		using DefaultVertexFormat = PackedVertexFormat <_VertexTy>;
+
+		/* the positions quantised by the mesh bounds and the half float texcoords, 12 bytes per 3D vertex instead of 20 */
+		template <Detail::Vertex _VertexTy>
+		using CompactVertexFormat = PackedVertexFormat <_VertexTy, PositionEncoding::unorm16, TexcoordEncoding::float16>;
+	}
+
+	namespace Detail
+	{
+		template <class _Ty>
+		concept PackedFormat = requires (typename _Ty::source_type const& vertex, typename _Ty::Range const& range)
+		{
+			typename _Ty::vertex_type;
+
+			{ _Ty::pack(vertex, range) } -> std::same_as <typename _Ty::vertex_type>;
+			{ _Ty::make_decode_matrix(range) } -> std::same_as <glm::mat4>;
+		};
+	}
+}
\ No newline at end of file
@@ -28,7 +28,7 @@ namespace Coli
 				}
 
 				static void x_failed_create_window() {
-					throw std::runtime_error("Failed to create a window");
+					throw std::runtime_error("Failed to create a window with an OpenGL 4.6 context");
 				}
 
 			protected:
@@ -40,6 +40,9 @@ namespace Coli
 				{
 					if (Graphics::OpenGL::Context::exist())
 					{
+						glfwWindowHint (GLFW_CONTEXT_VERSION_MAJOR, GLADContext::version_major);
+						glfwWindowHint (GLFW_CONTEXT_VERSION_MINOR, GLADContext::version_minor);
+
 						myHandle = glfwCreateWindow (width, 
 							height, title.data(), nullptr, nullptr);
 